@@ -0,0 +1,12 @@
+#!/bin/sh
+set -eu
+
+VFLAG=${VERBOSE:+-v}
+BFLAG="-b ./target/acir.gz"
+FLAGS="-c $CRS_PATH $VFLAG"
+
+# Test the Ultra Honk proof/verify flow, verifying two proofs against a shared vk with a single batched pairing.
+$BIN prove_ultra_honk -o proof_0 $FLAGS $BFLAG
+$BIN prove_ultra_honk -o proof_1 $FLAGS $BFLAG
+$BIN write_vk_ultra_honk -o vk $FLAGS $BFLAG
+$BIN verify_batch -k vk -p proof_0 -p proof_1 $FLAGS
@@ -12,6 +12,8 @@
 #include "log.hpp"
 #include <barretenberg/common/benchmark.hpp>
 #include <barretenberg/common/container.hpp>
+#include <barretenberg/common/numa.hpp>
+#include <barretenberg/common/slab_allocator.hpp>
 #include <barretenberg/common/timer.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
@@ -140,6 +142,20 @@ bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessP
     return verified;
 }
 
+/**
+ * @brief Initialize the global crs_factory for bn254 with enough points to commit to the polynomials of a Honk circuit
+ *
+ * @param builder
+ */
+template <typename Builder> void init_honk_crs(Builder& builder)
+{
+    // TODO(https://github.com/AztecProtocol/barretenberg/issues/811): Add a buffer to the expected circuit size to
+    // account for the addition of "gates to ensure nonzero polynomials" (in Honk only).
+    const size_t additional_gates_buffer = 15; // conservatively large to be safe
+    size_t srs_size = builder.get_circuit_subgroup_size(builder.get_total_circuit_size() + additional_gates_buffer);
+    init_bn254_crs(srs_size);
+}
+
 template <IsUltraFlavor Flavor>
 bool proveAndVerifyHonkAcirFormat(acir_format::AcirFormat constraint_system, acir_format::WitnessVector witness)
 {
@@ -151,11 +167,7 @@ bool proveAndVerifyHonkAcirFormat(acir_format::AcirFormat constraint_system, aci
     // Construct a bberg circuit from the acir representation
     auto builder = acir_format::create_circuit<Builder>(constraint_system, 0, witness);
 
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/811): Add a buffer to the expected circuit size to
-    // account for the addition of "gates to ensure nonzero polynomials" (in Honk only).
-    const size_t additional_gates_buffer = 15; // conservatively large to be safe
-    size_t srs_size = builder.get_circuit_subgroup_size(builder.get_total_circuit_size() + additional_gates_buffer);
-    init_bn254_crs(srs_size);
+    init_honk_crs(builder);
 
     // Construct Honk proof
     Prover prover{ builder };
@@ -211,6 +223,145 @@ bool proveAndVerifyHonkProgram(const std::string& bytecodePath, const std::strin
     return true;
 }
 
+/**
+ * @brief The serialized form of an Ultra Honk verification key
+ * @details The commitments are stored in the order of VerificationKey::get_all(). The pcs verification key is not
+ * serialized, it only depends on the CRS.
+ */
+struct HonkVerificationKeyData {
+    uint64_t circuit_size;
+    uint64_t num_public_inputs;
+    uint64_t pub_inputs_offset;
+    std::vector<curve::BN254::AffineElement> commitments;
+
+    // For serialization, update with any new fields
+    MSGPACK_FIELDS(circuit_size, num_public_inputs, pub_inputs_offset, commitments);
+};
+
+/**
+ * @brief Creates an Ultra Honk proof for an ACIR circuit
+ *
+ * Communication:
+ * - stdout: The proof is written to stdout as a byte array
+ * - Filesystem: The proof is written to the path specified by outputPath
+ *
+ * @param bytecodePath Path to the file containing the serialized circuit
+ * @param witnessPath Path to the file containing the serialized witness
+ * @param outputPath Path to write the proof to
+ */
+void prove_ultra_honk(const std::string& bytecodePath, const std::string& witnessPath, const std::string& outputPath)
+{
+    auto constraint_system = get_constraint_system(bytecodePath);
+    auto witness = get_witness(witnessPath);
+
+    auto builder = acir_format::create_circuit<UltraCircuitBuilder>(constraint_system, 0, witness);
+    init_honk_crs(builder);
+
+    UltraProver prover{ builder };
+    auto proof = to_buffer(prover.construct_proof());
+
+    if (outputPath == "-") {
+        writeRawBytesToStdout(proof);
+        vinfo("proof written to stdout");
+    } else {
+        write_file(outputPath, proof);
+        vinfo("proof written to: ", outputPath);
+    }
+}
+
+/**
+ * @brief Writes an Ultra Honk verification key for an ACIR circuit to a file
+ *
+ * Communication:
+ * - stdout: The verification key is written to stdout as a byte array
+ * - Filesystem: The verification key is written to the path specified by outputPath
+ *
+ * @param bytecodePath Path to the file containing the serialized circuit
+ * @param outputPath Path to write the verification key to
+ */
+void write_vk_ultra_honk(const std::string& bytecodePath, const std::string& outputPath)
+{
+    auto constraint_system = get_constraint_system(bytecodePath);
+
+    auto builder = acir_format::create_circuit<UltraCircuitBuilder>(constraint_system);
+    init_honk_crs(builder);
+
+    ProverInstance_<UltraFlavor> instance{ builder };
+    UltraFlavor::VerificationKey verification_key{ instance.proving_key };
+
+    HonkVerificationKeyData vk_data{ verification_key.circuit_size,
+                                     verification_key.num_public_inputs,
+                                     verification_key.pub_inputs_offset,
+                                     {} };
+    for (const auto& commitment : verification_key.get_all()) {
+        vk_data.commitments.emplace_back(commitment);
+    }
+    auto vk = to_buffer(vk_data);
+
+    if (outputPath == "-") {
+        writeRawBytesToStdout(vk);
+        vinfo("vk written to stdout");
+    } else {
+        write_file(outputPath, vk);
+        vinfo("vk written to: ", outputPath);
+    }
+}
+
+/**
+ * @brief Verifies a batch of Ultra Honk proofs, sharing a single pairing check between all of them
+ *
+ * Communication:
+ * - proc_exit: A boolean value is returned indicating whether every proof is valid.
+ *   an exit code of 0 will be returned for success and 1 for failure.
+ *
+ * @param proof_paths Paths to the files containing the serialized proofs
+ * @param vk_paths Paths to the files containing the serialized verification key of each proof, or a single path if
+ * the proofs share a verification key
+ * @return true If every proof is valid
+ * @return false If any of the proofs is invalid
+ */
+bool verify_batch(const std::vector<std::string>& proof_paths, const std::vector<std::string>& vk_paths)
+{
+    using VerificationKey = UltraFlavor::VerificationKey;
+
+    if (proof_paths.empty()) {
+        throw_or_abort("verify_batch expects at least one proof");
+    }
+    if (vk_paths.size() != proof_paths.size() && vk_paths.size() != 1) {
+        throw_or_abort("verify_batch expects one verification key per proof, or a single shared one");
+    }
+
+    // Only the G2 points are needed to verify
+    auto g2_data = get_bn254_g2_data(CRS_PATH);
+    srs::init_crs_factory({}, g2_data);
+    auto pcs_verification_key = std::make_shared<UltraFlavor::VerifierCommitmentKey>();
+
+    std::vector<std::shared_ptr<VerificationKey>> keys;
+    for (const auto& vk_path : vk_paths) {
+        auto vk_data = from_buffer<HonkVerificationKeyData>(read_file(vk_path));
+        auto key = std::make_shared<VerificationKey>(vk_data.circuit_size, vk_data.num_public_inputs);
+        key->pub_inputs_offset = vk_data.pub_inputs_offset;
+        key->pcs_verification_key = pcs_verification_key;
+        if (vk_data.commitments.size() != key->get_all().size()) {
+            throw_or_abort("malformed verification key: " + vk_path);
+        }
+        for (auto [commitment, data] : zip_view(key->get_all(), vk_data.commitments)) {
+            commitment = data;
+        }
+        keys.emplace_back(std::move(key));
+    }
+
+    std::vector<HonkProof> proofs;
+    for (const auto& proof_path : proof_paths) {
+        proofs.emplace_back(from_buffer<HonkProof>(read_file(proof_path)));
+    }
+
+    auto verified = UltraVerifier::batch_verify_proofs(keys, proofs);
+
+    vinfo("verified ", proofs.size(), " proofs: ", verified);
+    return verified;
+}
+
 /**
  * @brief Proves and Verifies an ACIR circuit
  *
@@ -583,11 +734,27 @@ std::string get_option(std::vector<std::string>& args, const std::string& option
     return (itr != args.end() && std::next(itr) != args.end()) ? *(std::next(itr)) : defaultValue;
 }
 
+// The values of every occurrence of an option, for options that may be repeated
+std::vector<std::string> get_options(std::vector<std::string>& args, const std::string& option)
+{
+    std::vector<std::string> values;
+    for (auto itr = args.begin(); itr != args.end() && std::next(itr) != args.end(); ++itr) {
+        if (*itr == option) {
+            values.emplace_back(*std::next(itr));
+        }
+    }
+    return values;
+}
+
 int main(int argc, char* argv[])
 {
     try {
         std::vector<std::string> args(argv + 1, argv + argc);
         verbose = flag_present(args, "-v") || flag_present(args, "--verbose");
+        // Overrides BB_NUMA. Must be set before any parallel work starts the thread pool.
+        if (flag_present(args, "--numa")) {
+            set_numa_policy(parse_numa_policy(get_option(args, "--numa", "")));
+        }
 
         if (args.empty()) {
             std::cerr << "No command provided.\n";
@@ -603,6 +770,22 @@ int main(int argc, char* argv[])
         std::string pk_path = get_option(args, "-r", "./target/pk");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
 
+        // All of the command's slab memory comes from one arena, whose usage is reported on the way out
+        struct ArenaReport {
+            SlabArena arena;
+            ArenaReport(const ArenaReport&) = delete;
+            ArenaReport(ArenaReport&&) = delete;
+            ArenaReport& operator=(const ArenaReport&) = delete;
+            ArenaReport& operator=(ArenaReport&&) = delete;
+            ArenaReport() = default;
+            ~ArenaReport()
+            {
+                if (verbose) {
+                    arena.print_stats();
+                }
+            }
+        } arena_report;
+
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
             writeStringToStdout(BB_VERSION);
@@ -636,6 +819,15 @@ int main(int argc, char* argv[])
             gateCount(bytecode_path);
         } else if (command == "verify") {
             return verify(proof_path, vk_path) ? 0 : 1;
+        } else if (command == "prove_ultra_honk") {
+            std::string output_path = get_option(args, "-o", "./proofs/proof");
+            prove_ultra_honk(bytecode_path, witness_path, output_path);
+        } else if (command == "write_vk_ultra_honk") {
+            std::string output_path = get_option(args, "-o", "./target/vk");
+            write_vk_ultra_honk(bytecode_path, output_path);
+        } else if (command == "verify_batch") {
+            // e.g. bb verify_batch -k vk_0 -p proof_0 -k vk_1 -p proof_1, or a single -k shared by every proof
+            return verify_batch(get_options(args, "-p"), get_options(args, "-k")) ? 0 : 1;
         } else if (command == "contract") {
             std::string output_path = get_option(args, "-o", "./target/contract.sol");
             contract(output_path, vk_path);
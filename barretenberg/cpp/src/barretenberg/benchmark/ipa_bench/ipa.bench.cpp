@@ -64,6 +64,47 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+/**
+ * @brief Verification of 2**n openings of a polynomial of fixed size, either one by one or as a single batch sharing
+ * the MSM over the SRS
+ */
+void ipa_batch_verify(State& state, bool batched) noexcept
+{
+    constexpr size_t POLYNOMIAL_DEGREE_LOG2 = 14;
+    const size_t num_proofs = 1UL << static_cast<size_t>(state.range(0));
+
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1UL << POLYNOMIAL_DEGREE_LOG2;
+    Polynomial<Fr> poly(n);
+    for (size_t i = 0; i < n; ++i) {
+        poly[i] = Fr::random_element(&engine);
+    }
+    auto x = Fr::random_element(&engine);
+    const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    IPA<Curve>::compute_opening_proof(ck, opening_pair, poly, prover_transcript);
+    // The cost of verification does not depend on the proof, so a single one is checked repeatedly
+    const std::vector<OpeningClaim<Curve>> claims(num_proofs, { opening_pair, ck->commit(poly) });
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts(num_proofs);
+        for (auto& verifier_transcript : verifier_transcripts) {
+            verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+        }
+        state.ResumeTiming();
+        if (batched) {
+            auto result = IPA<Curve>::batch_reduce_verify(vk, claims, verifier_transcripts);
+            ASSERT(result);
+        } else {
+            for (size_t i = 0; i < num_proofs; ++i) {
+                auto result = IPA<Curve>::reduce_verify(vk, claims[i], verifier_transcripts[i]);
+                ASSERT(result);
+            }
+        }
+    }
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -73,4 +114,12 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK_CAPTURE(ipa_batch_verify, individual, /*batched=*/false)
+    ->Unit(kMillisecond)
+    ->DenseRange(0, 5)
+    ->Setup(DoSetup);
+BENCHMARK_CAPTURE(ipa_batch_verify, batched, /*batched=*/true)
+    ->Unit(kMillisecond)
+    ->DenseRange(0, 5)
+    ->Setup(DoSetup);
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 
@@ -8,6 +9,8 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <string>
 
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
@@ -16,6 +19,8 @@
 
 using namespace bb;
 
+auto& engine = bb::numeric::get_debug_randomness();
+
 // constexpr size_t NUM_GATES = 1 << 10;
 
 // size_t get_num_rounds(size_t bucket_size)
@@ -49,6 +54,8 @@ static bb::evaluation_domain large_domain;
 const auto init = []() {
     small_domain = bb::evaluation_domain(NUM_POINTS);
     large_domain = bb::evaluation_domain(NUM_POINTS * 4);
+    small_domain.compute_lookup_table();
+    large_domain.compute_lookup_table();
 
     fr element = fr::random_element();
     fr accumulator = element;
@@ -80,6 +87,49 @@ int pippenger()
     return 0;
 }
 
+/**
+ * @brief Compare the dense and sparse-aware MSMs on scalar distributions resembling the polynomials we commit to
+ */
+int sparse_pippenger()
+{
+    // A gate selector is one on the rows of its block and zero elsewhere; other polynomials (e.g. the lookup read
+    // counts) are mostly zero with some small values; wires are dense
+    const std::vector<std::pair<std::string, std::function<fr(size_t)>>> distributions = {
+        { "selector block (1/4 ones)", [](size_t i) { return fr(i < NUM_POINTS / 4); } },
+        { "interleaved selector (1/2 ones)", [](size_t i) { return fr(i % 2); } },
+        { "read counts (1/8 nonzero)",
+          [](size_t i) { return (i % 8 == 0) ? fr(1 + (engine.get_random_uint8() & 3)) : fr(0); } },
+        { "mixed (1/16 random, rest 0/1)",
+          [](size_t i) { return (i % 16 == 0) ? fr::random_element() : fr(i % 3 == 0); } },
+        { "dense", [](size_t) { return fr::random_element(); } },
+    };
+
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
+    for (const auto& [name, distribution] : distributions) {
+        std::vector<fr> poly(NUM_POINTS);
+        for (size_t i = 0; i < NUM_POINTS; ++i) {
+            poly[i] = distribution(i);
+        }
+
+        std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+        g1::element dense_result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            &poly[0], reference_string->get_monomial_points(), NUM_POINTS, state);
+        std::chrono::steady_clock::time_point time_mid = std::chrono::steady_clock::now();
+        g1::element sparse_result = scalar_multiplication::pippenger_sparse_unsafe<curve::BN254>(
+            poly, reference_string->get_monomial_points(), state);
+        std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+
+        ASSERT(dense_result == sparse_result);
+        std::chrono::microseconds dense_diff =
+            std::chrono::duration_cast<std::chrono::microseconds>(time_mid - time_start);
+        std::chrono::microseconds sparse_diff =
+            std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_mid);
+        std::cout << name << ": dense " << dense_diff.count() << "us, sparse " << sparse_diff.count() << "us"
+                  << std::endl;
+    }
+    return 0;
+}
+
 int coset_fft_split()
 {
     std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
@@ -115,5 +165,7 @@ int main()
     pippenger();
     pippenger();
     pippenger();
+    std::cout << "executing sparse-aware pippenger algorithm" << std::endl;
+    sparse_pippenger();
     return 0;
 }
@@ -37,10 +37,48 @@ template <typename Flavor> void fold_one(State& state) noexcept
     for (auto _ : state) {
         auto proof = folding_prover.fold_instances();
     }
+    state.counters["time_per_instance"] =
+        Counter(static_cast<double>(state.iterations()), Counter::kIsRate | Counter::kInvert);
+}
+
+// Fold k - 1 instances into an accumulator in a single round. The time per folded instance is comparable to that of
+// fold_one, which folds one instance per round.
+template <typename Flavor, size_t k> void fold_k(State& state) noexcept
+{
+    using ProverInstance = ProverInstance_<Flavor>;
+    using Instance = ProverInstance;
+    using Instances = ProverInstances_<Flavor, k>;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
+    using Builder = typename Flavor::CircuitBuilder;
+
+    bb::srs::init_crs_factory("../srs_db/ignition");
+
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+
+    const auto construct_instance = [&]() {
+        Builder builder;
+        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        return std::make_shared<ProverInstance>(builder);
+    };
+
+    std::vector<std::shared_ptr<Instance>> instances;
+    for (size_t idx = 0; idx < k; idx++) {
+        instances.emplace_back(construct_instance());
+    }
+
+    ProtoGalaxyProver folding_prover(instances);
+
+    for (auto _ : state) {
+        auto proof = folding_prover.fold_instances();
+    }
+    const auto num_folded_instances = static_cast<double>(state.iterations()) * static_cast<double>(k - 1);
+    state.counters["time_per_instance"] = Counter(num_folded_instances, Counter::kIsRate | Counter::kInvert);
 }
 
 BENCHMARK(fold_one<UltraFlavor>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
 BENCHMARK(fold_one<GoblinUltraFlavor>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(fold_k<UltraFlavor, 4>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
+BENCHMARK(fold_k<GoblinUltraFlavor, 4>)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
 } // namespace bb
 
 BENCHMARK_MAIN();
@@ -10,19 +10,31 @@ using namespace benchmark;
 namespace bb {
 
 template <typename Flavor>
-void _bench_round(::benchmark::State& state, void (*F)(ProtoGalaxyProver_<ProverInstances_<Flavor, 2>>&))
+void _bench_round(::benchmark::State& state,
+                  void (*F)(ProtoGalaxyProver_<ProverInstances_<Flavor, 2>>&),
+                  const bool half_padded = false)
 {
     using Builder = typename Flavor::CircuitBuilder;
     using ProverInstance = ProverInstance_<Flavor>;
     using Instances = ProverInstances_<Flavor, 2>;
     using ProtoGalaxyProver = ProtoGalaxyProver_<Instances>;
+    using FF = typename Flavor::FF;
 
     bb::srs::init_crs_factory("../srs_db/ignition");
     auto log2_num_gates = static_cast<size_t>(state.range(0));
 
     const auto construct_instance = [&]() {
         Builder builder;
-        MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        if (half_padded) {
+            // Overflow the next smaller dyadic size by a few gates, so that just under half of the trace is padding
+            MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates - 1);
+            uint32_t idx = builder.add_variable(FF::random_element());
+            for (size_t i = 0; i < 32; ++i) {
+                builder.create_big_add_gate({ idx, idx, idx, idx, FF(1), FF(1), FF(1), FF(-3), FF(0) });
+            }
+        } else {
+            MockCircuits::construct_arithmetic_circuit(builder, log2_num_gates);
+        }
         return std::make_shared<ProverInstance>(builder);
     };
 
@@ -55,6 +67,46 @@ void bench_round_goblin_ultra(::benchmark::State& state,
     _bench_round<GoblinUltraFlavor>(state, F);
 }
 
+// The same rounds on circuits that fill about half of their dyadic size
+void bench_round_ultra_padded(::benchmark::State& state,
+                              void (*F)(ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>&))
+{
+    _bench_round<UltraFlavor>(state, F, /*half_padded=*/true);
+}
+
+void bench_round_goblin_ultra_padded(::benchmark::State& state,
+                                     void (*F)(ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 2>>&))
+{
+    _bench_round<GoblinUltraFlavor>(state, F, /*half_padded=*/true);
+}
+
+/**
+ * @brief Build the perturbator coefficient tree over 2^state.range(0) random full Honk evaluations
+ */
+void bench_perturbator_coefficients(::benchmark::State& state)
+{
+    using FF = UltraFlavor::FF;
+    using ProtoGalaxyProver = ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>;
+
+    auto log2_num_gates = static_cast<size_t>(state.range(0));
+    std::vector<FF> betas(log2_num_gates);
+    std::vector<FF> deltas(log2_num_gates);
+    for (size_t i = 0; i < log2_num_gates; ++i) {
+        betas[i] = FF::random_element();
+        deltas[i] = FF::random_element();
+    }
+    std::vector<FF> full_honk_evaluations(1 << log2_num_gates);
+    for (auto& eval : full_honk_evaluations) {
+        eval = FF::random_element();
+    }
+
+    for (auto _ : state) {
+        DoNotOptimize(ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evaluations));
+    }
+}
+
+BENCHMARK(bench_perturbator_coefficients)->DenseRange(14, 20)->Unit(kMillisecond);
+
 BENCHMARK_CAPTURE(bench_round_ultra, preparation, [](auto& prover) { prover.preparation_round(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 BENCHMARK_CAPTURE(bench_round_ultra, perturbator, [](auto& prover) { prover.perturbator_round(); })
@@ -72,6 +124,12 @@ BENCHMARK_CAPTURE(bench_round_goblin_ultra, combiner_quotient, [](auto& prover)
     -> DenseRange(14, 20) -> Unit(kMillisecond);
 BENCHMARK_CAPTURE(bench_round_goblin_ultra, accumulator_update, [](auto& prover) { prover.accumulator_update_round(); })
     -> DenseRange(14, 20) -> Unit(kMillisecond);
+BENCHMARK_CAPTURE(bench_round_ultra_padded, combiner_quotient, [](auto& prover) { prover.combiner_quotient_round(); })
+    -> DenseRange(14, 20) -> Unit(kMillisecond);
+BENCHMARK_CAPTURE(bench_round_goblin_ultra_padded,
+                  combiner_quotient,
+                  [](auto& prover) { prover.combiner_quotient_round(); })
+    -> DenseRange(14, 20) -> Unit(kMillisecond);
 
 } // namespace bb
 
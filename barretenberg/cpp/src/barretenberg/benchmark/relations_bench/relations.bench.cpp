@@ -1,6 +1,7 @@
 #include "barretenberg/eccvm/eccvm_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/goblin_ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
+#include "barretenberg/sumcheck/sumcheck_round.hpp"
 #include "barretenberg/translator_vm/goblin_translator_flavor.hpp"
 #include <benchmark/benchmark.h>
 
@@ -31,6 +32,52 @@ template <typename Flavor, typename Relation> void execute_relation(::benchmark:
         Relation::accumulate(accumulator, new_value, params, 1);
     }
 }
+
+/**
+ * @brief Compute a full sumcheck round univariate over 2^12 rows, extending edges in blocks of state.range(0) edge
+ * groups. A block size of 1 extends one edge group at a time.
+ */
+template <typename Flavor> void compute_round_univariate(::benchmark::State& state)
+{
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+    const size_t log_round_size = 12;
+    const size_t round_size = 1 << log_round_size;
+
+    ProverPolynomials polynomials;
+    for (auto& poly : polynomials.get_all()) {
+        poly = Polynomial<FF>(round_size);
+        for (auto& coeff : poly) {
+            coeff = FF::random_element(&engine);
+        }
+    }
+    auto params = bb::RelationParameters<FF>::get_random();
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element(&engine);
+    }
+    std::vector<FF> betas(log_round_size);
+    for (auto& beta : betas) {
+        beta = FF::random_element(&engine);
+    }
+    PowPolynomial<FF> pow_polynomial(betas);
+    pow_polynomial.compute_values();
+
+    SumcheckProverRound<Flavor> round(round_size);
+    round.edge_block_size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        ::benchmark::DoNotOptimize(round.compute_univariate(polynomials, params, pow_polynomial, alpha));
+    }
+}
+BENCHMARK(compute_round_univariate<UltraFlavor>)->Arg(1)->Arg(4)->Arg(8)->Arg(16)->Unit(::benchmark::kMillisecond);
+BENCHMARK(compute_round_univariate<GoblinUltraFlavor>)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Unit(::benchmark::kMillisecond);
+
 BENCHMARK(execute_relation<UltraFlavor, UltraArithmeticRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, DeltaRangeConstraintRelation<Fr>>);
 BENCHMARK(execute_relation<UltraFlavor, EllipticRelation<Fr>>);
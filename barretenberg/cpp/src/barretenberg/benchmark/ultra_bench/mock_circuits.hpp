@@ -1,6 +1,7 @@
 #pragma once
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/crypto/merkle_tree/membership.hpp"
 #include "barretenberg/goblin/mock_circuits.hpp"
 #include "barretenberg/plonk/composer/standard_composer.hpp"
@@ -75,7 +76,10 @@ void construct_proof_with_specified_num_iterations(
 {
     srs::init_crs_factory("../srs_db/ignition");
 
+    size_t peak_bytes = 0;
     for (auto _ : state) {
+        // Track the peak of the slab memory (i.e. polynomials) held by the proving key and the prover
+        SlabArena arena;
         // Construct circuit and prover; don't include this part in measurement
         state.PauseTiming();
         Prover prover = get_prover<Prover>(test_circuit_function, num_iterations);
@@ -83,7 +87,9 @@ void construct_proof_with_specified_num_iterations(
 
         // Construct proof
         auto proof = prover.construct_proof();
+        peak_bytes = std::max(peak_bytes, arena.get_stats().peak_bytes);
     }
+    state.counters["peak_memory_MiB"] = static_cast<double>(peak_bytes) / (1024 * 1024);
 }
 
 } // namespace bb::mock_circuits
@@ -1,7 +1,9 @@
 #include <benchmark/benchmark.h>
 
 #include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
 
 using namespace benchmark;
 using namespace bb;
@@ -27,6 +29,64 @@ static void construct_proof_ultrahonk_power_of_2(State& state) noexcept
         state, &bb::mock_circuits::generate_basic_arithmetic_circuit<UltraCircuitBuilder>, log2_of_gates);
 }
 
+/**
+ * @brief Benchmark: Verification of 2**n Ultra Honk proofs of a small circuit, either each with its own pairing check or
+ * as a batch sharing a single one
+ */
+static void verify_proofs_ultrahonk(State& state, bool batched) noexcept
+{
+    srs::init_crs_factory("../srs_db/ignition");
+    const size_t num_proofs = 1UL << static_cast<size_t>(state.range(0));
+
+    UltraCircuitBuilder builder;
+    bb::mock_circuits::generate_basic_arithmetic_circuit(builder, 10);
+    UltraProver prover(builder);
+    auto verification_key = std::make_shared<UltraFlavor::VerificationKey>(prover.instance->proving_key);
+    // The cost of verification does not depend on the proof, so a single one is checked repeatedly
+    std::vector<HonkProof> proofs(num_proofs, prover.construct_proof());
+
+    for (auto _ : state) {
+        if (batched) {
+            DoNotOptimize(UltraVerifier::batch_verify_proofs({ verification_key }, proofs));
+        } else {
+            std::vector<uint8_t> verified(num_proofs);
+            parallel_for(num_proofs, [&](size_t i) {
+                UltraVerifier verifier(verification_key);
+                verified[i] = static_cast<uint8_t>(verifier.verify_proof(proofs[i]));
+            });
+            DoNotOptimize(verified);
+        }
+    }
+}
+
+/**
+ * @brief Benchmark: The final pairing check of 2**n Ultra Honk proofs, either one by one or as a single batched check
+ */
+static void pairing_check_ultrahonk(State& state, bool batched) noexcept
+{
+    using GroupElement = UltraFlavor::GroupElement;
+
+    srs::init_crs_factory("../srs_db/ignition");
+    const size_t num_proofs = 1UL << static_cast<size_t>(state.range(0));
+
+    UltraFlavor::VerifierCommitmentKey pcs_verification_key;
+    // Random points, so the checks fail, but their cost does not depend on the outcome
+    std::vector<std::array<GroupElement, 2>> pairing_points(num_proofs);
+    for (auto& points : pairing_points) {
+        points = { GroupElement::random_element(), GroupElement::random_element() };
+    }
+
+    for (auto _ : state) {
+        if (batched) {
+            DoNotOptimize(pcs_verification_key.batch_pairing_check(pairing_points));
+        } else {
+            for (const auto& points : pairing_points) {
+                DoNotOptimize(pcs_verification_key.pairing_check(points[0], points[1]));
+            }
+        }
+    }
+}
+
 // Define benchmarks
 BENCHMARK_CAPTURE(construct_proof_ultrahonk, sha256, &stdlib::generate_sha256_test_circuit<UltraCircuitBuilder>)
     ->Unit(kMillisecond);
@@ -46,4 +106,9 @@ BENCHMARK(construct_proof_ultrahonk_power_of_2)
     ->DenseRange(15, 20)
     ->Unit(kMillisecond);
 
+BENCHMARK_CAPTURE(verify_proofs_ultrahonk, individual, /*batched=*/false)->DenseRange(0, 8, 2)->Unit(kMillisecond);
+BENCHMARK_CAPTURE(verify_proofs_ultrahonk, batched, /*batched=*/true)->DenseRange(0, 8, 2)->Unit(kMillisecond);
+BENCHMARK_CAPTURE(pairing_check_ultrahonk, individual, /*batched=*/false)->DenseRange(0, 8, 2)->Unit(kMillisecond);
+BENCHMARK_CAPTURE(pairing_check_ultrahonk, batched, /*batched=*/true)->DenseRange(0, 8, 2)->Unit(kMillisecond);
+
 BENCHMARK_MAIN();
@@ -25,7 +25,46 @@ template <typename Curve> void bench_commit(::benchmark::State& state)
     }
 }
 
+// Commit to a batch of polynomials one at a time, as the provers used to
+template <typename Curve> void bench_commit_sequential(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_points = 1 << state.range(0);
+    const size_t num_polynomials = static_cast<size_t>(state.range(1));
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    for (auto _ : state) {
+        for (auto& polynomial : polynomials) {
+            benchmark::DoNotOptimize(key->commit(polynomial));
+        }
+    }
+}
+
+// Commit to the same batch of polynomials with a single call to batch_commit
+template <typename Curve> void bench_batch_commit(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_points = 1 << state.range(0);
+    const size_t num_polynomials = static_cast<size_t>(state.range(1));
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < num_polynomials; ++i) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    std::vector<std::span<const Fr>> spans(polynomials.begin(), polynomials.end());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(key->batch_commit(spans));
+    }
+}
+
 BENCHMARK(bench_commit<curve::BN254>)->DenseRange(10, MAX_LOG_NUM_POINTS)->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_sequential<curve::BN254>)
+    ->ArgsProduct({ { 12, 16, 20 }, { 2, 4, 8 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_batch_commit<curve::BN254>)
+    ->ArgsProduct({ { 12, 16, 20 }, { 2, 4, 8 } })
+    ->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
@@ -64,6 +64,11 @@ template <class Curve> class CommitmentKey {
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
+     * @details Many of the polynomials we commit to (selectors, ecc op wires, databus columns, read counts) are
+     * mostly zeros and ones. The MSM detects this and skips the zero coefficients and adds the points of the unit
+     * coefficients directly; dense polynomials go through the regular Pippenger. If the SRS holds a fixed-base table,
+     * the MSM uses it instead.
+     *
      * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
      * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
      */
@@ -72,8 +77,73 @@ template <class Curve> class CommitmentKey {
         BB_OP_COUNT_TIME();
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
-        return scalar_multiplication::pippenger_unsafe<Curve>(
-            const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
+        if (srs->get_precomputed_monomial_points() != nullptr) {
+            return scalar_multiplication::pippenger_fixed_base_unsafe<Curve>(
+                polynomial, srs->get_precomputed_monomial_points(), srs->get_precomputed_window_bits());
+        }
+        return scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            polynomial, srs->get_monomial_points(), pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Uses the ProverSRS to create a commitment to p(X), using only the points of its active range
+     *
+     * @details A structured polynomial (see Polynomial::start_index()) only stores the coefficients of its active range
+     * [s, e), so the commitment is computed as ∑ᵢ aᵢ⋅Gᵢ over that range alone.
+     *
+     * @param polynomial a univariate polynomial p(X) = ∑ᵢ aᵢ⋅Xⁱ
+     * @return Commitment computed as C = [p(x)] = ∑ᵢ aᵢ⋅Gᵢ
+     */
+    Commitment commit(const Polynomial<Fr>& polynomial)
+    {
+        const size_t start = polynomial.start_index();
+        if (start == 0) {
+            return commit(std::span<const Fr>(polynomial));
+        }
+        BB_OP_COUNT_TIME();
+        ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+        if (srs->get_precomputed_monomial_points() != nullptr) {
+            const size_t window_bits = srs->get_precomputed_window_bits();
+            return scalar_multiplication::pippenger_fixed_base_unsafe<Curve>(
+                polynomial,
+                srs->get_precomputed_monomial_points() +
+                    start * scalar_multiplication::get_num_signed_digit_rounds(window_bits),
+                window_bits);
+        }
+        // The point table holds each point followed by its endomorphism
+        return scalar_multiplication::pippenger_sparse_unsafe<Curve>(
+            polynomial, srs->get_monomial_points() + 2 * start, pippenger_runtime_state);
+    };
+
+    /**
+     * @brief Commit to several polynomials at once
+     *
+     * @details Equivalent to calling commit() on each polynomial, but the MSMs are scheduled together over the shared
+     * SRS point table (see scalar_multiplication::pippenger_batch_unsafe), so that all threads stay busy for the
+     * whole batch instead of synchronising at the end of every phase of every MSM.
+     *
+     * @param polynomials the polynomials p₀(X), …, pₖ₋₁(X)
+     * @return std::vector<Commitment> [p₀(x)], …, [pₖ₋₁(x)]
+     */
+    std::vector<Commitment> batch_commit(std::span<std::span<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        for (const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() <= srs->get_monomial_size());
+        }
+        // each MSM against a fixed-base table is already a single parallel pass over the points
+        if (srs->get_precomputed_monomial_points() != nullptr) {
+            std::vector<Commitment> commitments;
+            commitments.reserve(polynomials.size());
+            for (const auto& polynomial : polynomials) {
+                commitments.emplace_back(commit(polynomial));
+            }
+            return commitments;
+        }
+        auto results =
+            scalar_multiplication::pippenger_batch_unsafe<Curve>(polynomials, srs->get_monomial_points());
+        Curve::Element::batch_normalize(results.data(), results.size());
+        return { results.begin(), results.end() };
     };
 };
 
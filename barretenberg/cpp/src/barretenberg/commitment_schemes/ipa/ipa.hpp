@@ -2,11 +2,16 @@
 #include "barretenberg/commitment_schemes/claim.hpp"
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
+#include <span>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace bb {
@@ -167,11 +172,16 @@ template <typename Curve_> class IPA {
         // The SRS stored in the commitment key is the result after applying the pippenger point table so the
         // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
         // G_vec_local should use only the original SRS thus we extract only the even indices.
+        // The MSMs for L_i and R_i read G from a point table in the same format, which is kept up to date as G is
+        // folded, so that they don't need to allocate and build a fresh one for every round.
+        std::vector<Commitment> G_table(2 * poly_length);
         run_loop_in_parallel_if_effective(
             poly_length,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
+            [&G_vec_local, &G_table, srs_elements](size_t start, size_t end) {
                 for (size_t i = start * 2; i < end * 2; i += 2) {
                     G_vec_local[i >> 1] = srs_elements[i];
+                    G_table[i] = srs_elements[i];
+                    G_table[i + 1] = srs_elements[i + 1];
                 }
             },
             /*finite_field_additions_per_iteration=*/0,
@@ -180,7 +190,7 @@ template <typename Curve_> class IPA {
             /*group_element_additions_per_iteration=*/0,
             /*group_element_doublings_per_iteration=*/0,
             /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
+            /*sequential_copy_ops_per_iteration=*/3);
 
         // Step 5.
         // Compute vector b (vector of the powers of the challenge)
@@ -205,59 +215,28 @@ template <typename Curve_> class IPA {
         GroupElement R_i;
         std::size_t round_size = poly_length;
 
-#ifndef NO_MULTITHREADING
-        //  The inner products we'll be computing in parallel need a mutex to be thread-safe during the last
-        //  accumulation
-        std::mutex inner_product_accumulation_mutex;
-#endif
+        // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo > for the first
+        // round. For the following ones they are computed while folding a_vec and b_vec.
+        Fr inner_prod_L;
+        Fr inner_prod_R;
+        std::tie(inner_prod_L, inner_prod_R) =
+            fold_and_compute_inner_products</*fold=*/false>(a_vec, b_vec, round_size, Fr::zero(), Fr::zero());
+
         // Step 6.
         // Perform IPA reduction rounds
         for (size_t i = 0; i < log_poly_degree; i++) {
             round_size >>= 1;
-            // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
-            Fr inner_prod_L = Fr::zero();
-            Fr inner_prod_R = Fr::zero();
-            // Run scalar products in parallel
-            run_loop_in_parallel_if_effective(
-                round_size,
-                [&a_vec,
-                 &b_vec,
-                 round_size,
-                 &inner_prod_L,
-                 &inner_prod_R
-#ifndef NO_MULTITHREADING
-                 ,
-                 &inner_product_accumulation_mutex
-#endif
-            ](size_t start, size_t end) {
-                    Fr current_inner_prod_L = Fr::zero();
-                    Fr current_inner_prod_R = Fr::zero();
-                    for (size_t j = start; j < end; j++) {
-                        current_inner_prod_L += a_vec[j] * b_vec[round_size + j];
-                        current_inner_prod_R += a_vec[round_size + j] * b_vec[j];
-                    }
-                    // Update the accumulated results thread-safely
-                    {
-#ifndef NO_MULTITHREADING
-                        std::unique_lock<std::mutex> lock(inner_product_accumulation_mutex);
-#endif
-                        inner_prod_L += current_inner_prod_L;
-                        inner_prod_R += current_inner_prod_R;
-                    }
-                },
-                /*finite_field_additions_per_iteration=*/2,
-                /*finite_field_multiplications_per_iteration=*/2);
 
             // Step 6.a (using letters, because doxygen automaticall converts the sublist counters to letters :( )
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
+            L_i = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+                &a_vec[0], &G_table[2 * round_size], round_size, ck->pippenger_runtime_state);
             L_i += aux_generator * inner_prod_L;
 
             // Step 6.b
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
+            R_i = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+                &a_vec[round_size], &G_table[0], round_size, ck->pippenger_runtime_state);
             R_i += aux_generator * inner_prod_R;
 
             // Step 6.c
@@ -273,6 +252,12 @@ template <typename Curve_> class IPA {
             if (round_challenge.is_zero()) {
                 throw_or_abort("IPA round challenge is zero");
             }
+
+            // After the last round only a_0 is needed
+            if (round_size == 1) {
+                a_vec[0] += round_challenge * a_vec[1];
+                break;
+            }
             const Fr round_challenge_inv = round_challenge.invert();
 
             // Step 6.e
@@ -285,22 +270,15 @@ template <typename Curve_> class IPA {
                 std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size) },
                 G_hi_by_inverse_challenge,
                 G_vec_local);
+            bb::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                &G_vec_local[0], &G_table[0], round_size);
 
             // Steps 6.e and 6.f
-            // Update the vectors a_vec, b_vec.
+            // Update the vectors a_vec, b_vec and compute the inner products of the next round.
             // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
             // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
-            run_loop_in_parallel_if_effective(
-                round_size,
-                [&a_vec, &b_vec, round_challenge, round_challenge_inv, round_size](size_t start, size_t end) {
-                    for (size_t j = start; j < end; j++) {
-                        a_vec[j] += round_challenge * a_vec[round_size + j];
-                        b_vec[j] += round_challenge_inv * b_vec[round_size + j];
-                    }
-                },
-                /*finite_field_additions_per_iteration=*/4,
-                /*finite_field_multiplications_per_iteration=*/8,
-                /*finite_field_inversions_per_iteration=*/1);
+            std::tie(inner_prod_L, inner_prod_R) = fold_and_compute_inner_products</*fold=*/true>(
+                a_vec, b_vec, round_size, round_challenge, round_challenge_inv);
         }
 
         // Step 7
@@ -308,6 +286,74 @@ template <typename Curve_> class IPA {
         transcript->send_to_verifier("IPA:a_0", a_vec[0]);
     }
 
+    /**
+     * @brief Optionally fold a and b down to their first round_size entries, then compute the inner products
+     * \f$\langle\vec{a}_{low},\vec{b}_{high}\rangle\f$ and \f$\langle\vec{a}_{high},\vec{b}_{low}\rangle\f$ of
+     * the result
+     * @details The folded entries \f$j\f$ and \f$j+\frac{round\_size}{2}\f$ are computed by the same iteration, so
+     * each of them is multiplied into the inner products straight away rather than in a separate pass over the vectors.
+     *
+     * @tparam fold Whether to fold \f$\vec{a}\leftarrow\vec{a}_{low}+u\cdot\vec{a}_{high}\f$ and
+     * \f$\vec{b}\leftarrow\vec{b}_{low}+u^{-1}\cdot\vec{b}_{high}\f$, where the vectors are of length 2*round_size
+     * @param round_size The length of the vectors after folding, at least 2
+     * @return {inner_prod_L, inner_prod_R}
+     */
+    template <bool fold>
+    static std::pair<Fr, Fr> fold_and_compute_inner_products(Polynomial& a_vec,
+                                                             std::vector<Fr>& b_vec,
+                                                             const size_t round_size,
+                                                             const Fr& round_challenge,
+                                                             const Fr& round_challenge_inv)
+    {
+        const size_t half_size = round_size >> 1;
+        Fr inner_prod_L = Fr::zero();
+        Fr inner_prod_R = Fr::zero();
+#ifndef NO_MULTITHREADING
+        //  The inner products we'll be computing in parallel need a mutex to be thread-safe during the last
+        //  accumulation
+        std::mutex inner_product_accumulation_mutex;
+#endif
+        run_loop_in_parallel_if_effective(
+            half_size,
+            [&a_vec,
+             &b_vec,
+             round_size,
+             half_size,
+             &round_challenge,
+             &round_challenge_inv,
+             &inner_prod_L,
+             &inner_prod_R
+#ifndef NO_MULTITHREADING
+             ,
+             &inner_product_accumulation_mutex
+#endif
+        ](size_t start, size_t end) {
+                Fr current_inner_prod_L = Fr::zero();
+                Fr current_inner_prod_R = Fr::zero();
+                for (size_t j = start; j < end; j++) {
+                    if constexpr (fold) {
+                        a_vec[j] += round_challenge * a_vec[round_size + j];
+                        a_vec[half_size + j] += round_challenge * a_vec[round_size + half_size + j];
+                        b_vec[j] += round_challenge_inv * b_vec[round_size + j];
+                        b_vec[half_size + j] += round_challenge_inv * b_vec[round_size + half_size + j];
+                    }
+                    current_inner_prod_L += a_vec[j] * b_vec[half_size + j];
+                    current_inner_prod_R += a_vec[half_size + j] * b_vec[j];
+                }
+                // Update the accumulated results thread-safely
+                {
+#ifndef NO_MULTITHREADING
+                    std::unique_lock<std::mutex> lock(inner_product_accumulation_mutex);
+#endif
+                    inner_prod_L += current_inner_prod_L;
+                    inner_prod_R += current_inner_prod_R;
+                }
+            },
+            /*finite_field_additions_per_iteration=*/fold ? 6 : 2,
+            /*finite_field_multiplications_per_iteration=*/fold ? 6 : 2);
+        return { inner_prod_L, inner_prod_R };
+    }
+
     /**
      * @brief Verify the correctness of a Proof
      *
@@ -337,6 +383,51 @@ template <typename Curve_> class IPA {
     static VerifierAccumulator reduce_verify_internal(const std::shared_ptr<VK>& vk,
                                                       const OpeningClaim<Curve>& opening_claim,
                                                       const std::shared_ptr<Transcript>& transcript)
+    {
+        // Steps 1-6 and 9.
+        auto reduced_claim = reduce_claim_internal(vk, opening_claim, transcript);
+
+        // Step 7.
+        // Construct the vector a₀⋅s, so that the MSM below directly yields a₀G₀
+        std::vector<Fr> s_vec(reduced_claim.poly_length);
+        compute_s_vec(reduced_claim.round_challenges_inv, reduced_claim.a_zero, s_vec);
+
+        // Step 8.
+        // Compute a₀G₀. The SRS stored in the verification key is already in the form of a pippenger point table (the
+        // values at odd indices contain the endomorphism of the preceding point), so it is used in place.
+        GroupElement a_zero_G_zero = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+            s_vec.data(), vk->srs->get_monomial_points(), reduced_claim.poly_length, vk->pippenger_runtime_state);
+
+        // Step 10.
+        // Compute C_right
+        const auto aux_generator = Commitment::one() * reduced_claim.generator_challenge;
+        GroupElement right_hand_side = a_zero_G_zero + aux_generator * (reduced_claim.a_zero * reduced_claim.b_zero);
+
+        // Step 11.
+        // Check if C_right == C₀
+        return (reduced_claim.C_zero.normalize() == right_hand_side.normalize());
+    }
+
+    /**
+     * @brief An opening claim reduced up to the final check \f$C_0 = a_0G_s + a_0b_0U\f$, i.e. everything but the
+     * MSM \f$G_s=\langle \vec{s},\vec{G}\rangle\f$ which dominates the cost of verification
+     */
+    struct ReducedClaim {
+        GroupElement C_zero;
+        Fr generator_challenge;
+        Fr a_zero;
+        Fr b_zero;
+        std::vector<Fr> round_challenges_inv;
+        size_t poly_length;
+    };
+
+    /**
+     * @brief Run steps 1-6 and 9 of the verifier (see reduce_verify_internal), leaving out the MSM over the SRS
+     */
+    template <typename Transcript>
+    static ReducedClaim reduce_claim_internal(const std::shared_ptr<VK>& vk,
+                                              const OpeningClaim<Curve>& opening_claim,
+                                              const std::shared_ptr<Transcript>& transcript)
     {
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
@@ -399,70 +490,106 @@ template <typename Curve_> class IPA {
                                    opening_claim.opening_pair.challenge.pow(exponent));
         }
 
-        // Step 7.
-        // Construct vector s
-        std::vector<Fr> s_vec(poly_length);
+        // Step 9.
+        // Receive a₀ from the prover
+        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
 
-        // TODO(https://github.com/AztecProtocol/barretenberg/issues/857): This code is not efficient as its
-        // O(nlogn). This can be optimized to be linear by computing a tree of products. Its very readable, so we're
-        // leaving it unoptimized for now.
-        run_loop_in_parallel_if_effective(
-            poly_length,
-            [&s_vec, &round_challenges_inv, log_poly_degree](size_t start, size_t end) {
-                for (size_t i = start; i < end; i++) {
-                    Fr s_vec_scalar = Fr::one();
-                    for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                        auto bit = (i >> j) & 1;
-                        bool b = static_cast<bool>(bit);
-                        if (b) {
-                            s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
-                        }
+        return { C_zero, generator_challenge, a_zero, b_zero, std::move(round_challenges_inv), poly_length };
+    }
+
+    /**
+     * @brief Compute \f$w\cdot\vec{s}\f$, where \f$s_i=\prod_{j:\ bit_j(i)=1}u_{k-1-j}^{-1}\f$
+     * @details The vector is built as a tree of products: once the first \f$2^j\f$ entries are known, the next
+     * \f$2^j\f$ are obtained by multiplying them by the challenge of bit \f$j\f$. This takes \f$d\f$
+     * multiplications in total rather than \f$d\log d\f$.
+     *
+     * @param round_challenges_inv \f$(u_{k-1}^{-1},...,u_0^{-1})\f$ in the order they were received
+     * @param weight \f$w\f$, the value of \f$s_0\f$
+     * @param s_vec Output of length \f$2^k\f$
+     */
+    static void compute_s_vec(const std::vector<Fr>& round_challenges_inv, const Fr& weight, std::span<Fr> s_vec)
+    {
+        const size_t log_poly_degree = round_challenges_inv.size();
+        s_vec[0] = weight;
+        for (size_t j = 0; j < log_poly_degree; j++) {
+            const size_t half = 1UL << j;
+            const Fr& challenge = round_challenges_inv[log_poly_degree - 1 - j];
+            run_loop_in_parallel_if_effective(
+                half,
+                [&s_vec, &challenge, half](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        s_vec[half + i] = s_vec[i] * challenge;
                     }
-                    s_vec[i] = s_vec_scalar;
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/log_poly_degree);
+                },
+                /*finite_field_additions_per_iteration=*/0,
+                /*finite_field_multiplications_per_iteration=*/1);
+        }
+    }
 
-        auto* srs_elements = vk->srs->get_monomial_points();
+    /**
+     * @brief Check several reduced claims with a single MSM over the SRS
+     * @details For random \f$r_i\f$ (\f$r_0=1\f$) the claims hold simultaneously iff, except with negligible
+     * probability, \f$\sum r_iC_{0,i} = \langle\sum r_ia_{0,i}\vec{s}_i,\vec{G}\rangle + (\sum
+     * r_ia_{0,i}b_{0,i}u_i)\cdot G\f$. Shorter claims use a prefix of the SRS, so their s-vectors are implicitly padded
+     * with zeroes.
+     */
+    static VerifierAccumulator batch_verify_reduced_claims(const std::shared_ptr<VK>& vk,
+                                                           std::span<const ReducedClaim> reduced_claims)
+    {
+        size_t max_poly_length = 0;
+        for (const auto& claim : reduced_claims) {
+            max_poly_length = std::max(max_poly_length, claim.poly_length);
+        }
+        if (max_poly_length == 0) {
+            return true;
+        }
 
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_length);
+        std::vector<Fr> batched_s_vec(max_poly_length, Fr::zero());
+        std::vector<Fr> s_vec(max_poly_length);
+        GroupElement batched_C_zero = GroupElement::infinity();
+        Fr batched_generator_scalar = Fr::zero();
+        for (size_t i = 0; i < reduced_claims.size(); i++) {
+            const auto& claim = reduced_claims[i];
+            const Fr batching_scalar = i == 0 ? Fr::one() : Fr::random_element();
 
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        run_loop_in_parallel_if_effective(
-            poly_length,
-            [&G_vec_local, srs_elements](size_t start, size_t end) {
-                for (size_t i = start * 2; i < end * 2; i += 2) {
-                    G_vec_local[i >> 1] = srs_elements[i];
-                }
-            },
-            /*finite_field_additions_per_iteration=*/0,
-            /*finite_field_multiplications_per_iteration=*/0,
-            /*finite_field_inversions_per_iteration=*/0,
-            /*group_element_additions_per_iteration=*/0,
-            /*group_element_doublings_per_iteration=*/0,
-            /*scalar_multiplications_per_iteration=*/0,
-            /*sequential_copy_ops_per_iteration=*/1);
+            batched_C_zero += claim.C_zero * batching_scalar;
+            const Fr weight = batching_scalar * claim.a_zero;
+            batched_generator_scalar += weight * claim.b_zero * claim.generator_challenge;
 
-        // Step 8.
-        // Compute G₀
-        auto G_zero = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_length, vk->pippenger_runtime_state);
+            std::span<Fr> claim_s_vec(s_vec.data(), claim.poly_length);
+            compute_s_vec(claim.round_challenges_inv, weight, claim_s_vec);
+            run_loop_in_parallel_if_effective(
+                claim.poly_length,
+                [&batched_s_vec, &claim_s_vec](size_t start, size_t end) {
+                    for (size_t j = start; j < end; j++) {
+                        batched_s_vec[j] += claim_s_vec[j];
+                    }
+                },
+                /*finite_field_additions_per_iteration=*/1);
+        }
 
-        // Step 9.
-        // Receive a₀ from the prover
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        GroupElement right_hand_side = bb::scalar_multiplication::pippenger_unsafe<Curve>(
+            batched_s_vec.data(), vk->srs->get_monomial_points(), max_poly_length, vk->pippenger_runtime_state);
+        right_hand_side += Commitment::one() * batched_generator_scalar;
 
-        // Step 10.
-        // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+        return (batched_C_zero.normalize() == right_hand_side.normalize());
+    }
 
-        // Step 11.
-        // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+    /**
+     * @brief Verify several proofs, each against its own transcript, with a single MSM over the SRS
+     */
+    template <typename Transcript>
+    static VerifierAccumulator batch_reduce_verify_internal(const std::shared_ptr<VK>& vk,
+                                                            std::span<const OpeningClaim<Curve>> opening_claims,
+                                                            std::span<const std::shared_ptr<Transcript>> transcripts)
+    {
+        ASSERT(opening_claims.size() == transcripts.size());
+        std::vector<ReducedClaim> reduced_claims;
+        reduced_claims.reserve(opening_claims.size());
+        for (size_t i = 0; i < opening_claims.size(); i++) {
+            reduced_claims.emplace_back(reduce_claim_internal(vk, opening_claims[i], transcripts[i]));
+        }
+        return batch_verify_reduced_claims(vk, reduced_claims);
     }
 
   public:
@@ -504,6 +631,26 @@ template <typename Curve_> class IPA {
     {
         return reduce_verify_internal(vk, opening_claim, transcript);
     }
+
+    /**
+     * @brief Verify several opening proofs at once, deferring the MSM over the SRS of each of them into a single MSM
+     * over a random linear combination of their s-vectors
+     *
+     * @param vk Verification_key containing srs and pippenger_runtime_state to be used for MSM
+     * @param opening_claims The claims, each containing the commitment C and opening pair \f$(\beta, f(\beta))\f$
+     * @param transcripts The transcript of each proof, in the same order as the claims
+     *
+     * @return true iff every proof verifies (except with negligible probability)
+     *
+     * @remark The batching is described in \link IPA::batch_verify_reduced_claims batch_verify_reduced_claims
+     * \endlink
+     */
+    static VerifierAccumulator batch_reduce_verify(const std::shared_ptr<VK>& vk,
+                                                   std::span<const OpeningClaim<Curve>> opening_claims,
+                                                   std::span<const std::shared_ptr<NativeTranscript>> transcripts)
+    {
+        return batch_reduce_verify_internal(vk, opening_claims, transcripts);
+    }
 };
 
 } // namespace bb
\ No newline at end of file
@@ -232,6 +232,44 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+/**
+ * @brief Verify openings of polynomials of different sizes as a single batch, and check that the batch is rejected if
+ * any one of them is invalid
+ */
+TEST_F(IPATest, BatchOpen)
+{
+    using IPA = IPA<Curve>;
+    const std::vector<size_t> poly_lengths = { 128, 4, 32, 128 };
+
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (const size_t n : poly_lengths) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        auto commitment = this->commit(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, commitment });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+        proofs.push_back(prover_transcript->proof_data);
+    }
+
+    const auto batch_verify = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& proof : proofs) {
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>(proof));
+        }
+        return IPA::batch_reduce_verify(this->vk(), opening_claims, verifier_transcripts);
+    };
+
+    EXPECT_TRUE(batch_verify());
+
+    // Claim a wrong evaluation for one of the polynomials
+    opening_claims[2].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(batch_verify());
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -49,6 +49,66 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(this->vk()->pairing_check(pairing_points[0], pairing_points[1]), true);
 }
 
+/**
+ * @brief Check the pairing inputs of several independent openings with a single batched pairing, and that the batch
+ * is rejected if any one of the openings is invalid.
+ */
+TYPED_TEST(KZGTest, BatchPairingCheck)
+{
+    const size_t n = 16;
+    const size_t num_openings = 4;
+
+    using KZG = KZG<TypeParam>;
+    using Fr = typename TypeParam::ScalarField;
+
+    std::vector<typename KZG::VerifierAccumulator> batch;
+    for (size_t i = 0; i < num_openings; ++i) {
+        auto witness = this->random_polynomial(n);
+        g1::element commitment = this->commit(witness);
+
+        auto challenge = Fr::random_element();
+        auto evaluation = witness.evaluate(challenge);
+        auto opening_pair = OpeningPair<TypeParam>{ challenge, evaluation };
+        auto opening_claim = OpeningClaim<TypeParam>{ opening_pair, commitment };
+
+        auto prover_transcript = NativeTranscript::prover_init_empty();
+        KZG::compute_opening_proof(this->ck(), opening_pair, witness, prover_transcript);
+
+        auto verifier_transcript = NativeTranscript::verifier_init_empty(prover_transcript);
+        batch.emplace_back(KZG::reduce_verify(opening_claim, verifier_transcript));
+    }
+
+    EXPECT_TRUE(this->vk()->batch_pairing_check(batch));
+
+    // The same opening may appear more than once
+    batch.emplace_back(batch[0]);
+    EXPECT_TRUE(this->vk()->batch_pairing_check(batch));
+
+    // Corrupt one of the openings
+    batch[num_openings - 1][0] += TypeParam::Group::one;
+    EXPECT_FALSE(this->vk()->batch_pairing_check(batch));
+}
+
+TYPED_TEST(KZGTest, StructuredCommitment)
+{
+    const size_t n = 32;
+    const size_t start = 5;
+    const size_t size = 10;
+
+    using Polynomial = typename TestFixture::Polynomial;
+    using Fr = typename TypeParam::ScalarField;
+
+    // A structured polynomial only stores [start, start + size), its commitment must match that of the dense one
+    Polynomial structured(size, n, start);
+    Polynomial dense(n);
+    for (size_t i = start; i < start + size; ++i) {
+        structured[i] = Fr::random_element();
+        dense[i] = structured[i];
+    }
+
+    EXPECT_EQ(this->commit(structured), this->commit(dense));
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
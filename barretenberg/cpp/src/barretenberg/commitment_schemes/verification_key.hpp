@@ -15,9 +15,12 @@
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <array>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 
@@ -58,6 +61,63 @@ template <> class VerifierCommitmentKey<curve::BN254> {
 
         return (result == Curve::TargetField::one());
     }
+
+    /**
+     * @brief verifies a batch of pairing equations e(P₀ⁱ,[1]₂)e(P₁ⁱ,[x]₂) ≡ [1]ₜ with a single pairing check
+     * @details All of the equations pair against the same G2 points, so for random rᵢ (r₀ = 1) they hold
+     * simultaneously iff, except with negligible probability, e(∑ rᵢP₀ⁱ,[1]₂)e(∑ rᵢP₁ⁱ,[x]₂) ≡ [1]ₜ. This replaces N
+     * Miller loops and final exponentiations with one of each, at the cost of two MSMs of size N in G1.
+     *
+     * @param pairing_points the pairs {P₀ⁱ, P₁ⁱ} to be checked
+     * @return true iff every pairing equation holds
+     */
+    bool batch_pairing_check(std::span<const std::array<GroupElement, 2>> pairing_points)
+    {
+        const size_t num_pairs = pairing_points.size();
+        if (num_pairs == 0) {
+            return true;
+        }
+        if (num_pairs == 1) {
+            return pairing_check(pairing_points[0][0], pairing_points[0][1]);
+        }
+
+        std::vector<Curve::ScalarField> scalars(num_pairs);
+        scalars[0] = 1;
+        for (size_t i = 1; i < num_pairs; ++i) {
+            scalars[i] = Curve::ScalarField::random_element();
+        }
+
+        // Normalize all of the points with a single inversion
+        std::vector<GroupElement> points(2 * num_pairs);
+        for (size_t i = 0; i < num_pairs; ++i) {
+            points[i] = pairing_points[i][0];
+            points[num_pairs + i] = pairing_points[i][1];
+        }
+        GroupElement::batch_normalize(points.data(), points.size());
+
+        // The points come from proofs, so they may repeat. The point table cannot hold the point at infinity, so any
+        // such point is replaced by the generator with a zero weight.
+        scalar_multiplication::pippenger_runtime_state<Curve> state(num_pairs);
+        const auto combine = [&](size_t offset) {
+            std::vector<Curve::ScalarField> weights = scalars;
+            std::vector<Commitment> point_table(2 * num_pairs);
+            for (size_t i = 0; i < num_pairs; ++i) {
+                const auto& point = points[offset + i];
+                if (point.is_point_at_infinity()) {
+                    point_table[i] = Commitment::one();
+                    weights[i] = 0;
+                } else {
+                    point_table[i] = Commitment(point.x, point.y);
+                }
+            }
+            scalar_multiplication::generate_pippenger_point_table<Curve>(
+                point_table.data(), point_table.data(), num_pairs);
+            return scalar_multiplication::pippenger<Curve>(
+                weights.data(), point_table.data(), num_pairs, state, /*handle_edge_cases=*/true);
+        };
+
+        return pairing_check(combine(0), combine(num_pairs));
+    }
 };
 
 /**
@@ -64,9 +64,10 @@ template <typename PCS> class ZeroMorphProver_ {
      * @param u_challenge Multivariate challenge u = (u_0, ..., u_{d-1})
      * @return std::vector<Polynomial> The quotients q_k
      */
-    static std::vector<Polynomial> compute_multilinear_quotients(Polynomial polynomial, std::span<const FF> u_challenge)
+    static std::vector<Polynomial> compute_multilinear_quotients(const Polynomial& polynomial,
+                                                                 std::span<const FF> u_challenge)
     {
-        size_t log_N = numeric::get_msb(polynomial.size());
+        size_t log_N = numeric::get_msb(polynomial.virtual_size());
         // The size of the multilinear challenge must equal the log of the polynomial size
         ASSERT(log_N == u_challenge.size());
 
@@ -77,11 +78,13 @@ template <typename PCS> class ZeroMorphProver_ {
             quotients.emplace_back(Polynomial(size)); // degree 2^k - 1
         }
 
-        // Compute the coefficients of q_{n-1}
+        // Compute the coefficients of q_{n-1}. Only the range [start, end) of q and f_k can be nonzero, as the input
+        // is zero outside of its active range.
         size_t size_q = 1 << (log_N - 1);
+        auto [start, end] = fold_range(polynomial.start_index(), polynomial.end_index(), size_q);
         Polynomial q{ size_q };
-        for (size_t l = 0; l < size_q; ++l) {
-            q[l] = polynomial[size_q + l] - polynomial[l];
+        for (size_t l = start; l < end; ++l) {
+            q[l] = polynomial.get(size_q + l) - polynomial.get(l);
         }
 
         quotients[log_N - 1] = q.share();
@@ -89,29 +92,45 @@ template <typename PCS> class ZeroMorphProver_ {
         std::vector<FF> f_k;
         f_k.resize(size_q);
 
-        std::vector<FF> g(polynomial.data().get(), polynomial.data().get() + size_q);
-
         // Compute q_k in reverse order from k= n-2, i.e. q_{n-2}, ..., q_0
         for (size_t k = 1; k < log_N; ++k) {
-            // Compute f_k
-            for (size_t l = 0; l < size_q; ++l) {
-                f_k[l] = g[l] + u_challenge[log_N - k] * q[l];
+            // Compute f_k, updating f_{k-1} in place. f_0 is the low half of the input, which is read but not copied.
+            for (size_t l = start; l < end; ++l) {
+                f_k[l] = (k == 1 ? polynomial.get(l) : f_k[l]) + u_challenge[log_N - k] * q[l];
             }
 
             size_q = size_q / 2;
+            std::tie(start, end) = fold_range(start, end, size_q);
             q = Polynomial{ size_q };
 
-            for (size_t l = 0; l < size_q; ++l) {
+            for (size_t l = start; l < end; ++l) {
                 q[l] = f_k[size_q + l] - f_k[l];
             }
 
             quotients[log_N - k - 1] = q.share();
-            g = f_k;
         }
 
         return quotients;
     }
 
+    /**
+     * @brief Given that a polynomial f of size 2 * half is zero outside of [start, end), return a range outside of
+     * which both halves of f (and so any combination of them) are zero
+     */
+    static std::pair<size_t, size_t> fold_range(size_t start, size_t end, size_t half)
+    {
+        if (start >= end) {
+            return { 0, 0 };
+        }
+        if (end <= half) {
+            return { start, end };
+        }
+        if (start >= half) {
+            return { start - half, end - half };
+        }
+        return { 0, half };
+    }
+
     /**
      * @brief Construct batched, lifted-degree univariate quotient \hat{q} = \sum_k y^k * X^{N - d_k - 1} * q_k
      * @details The purpose of the batched lifted-degree quotient is to reduce the individual degree checks
@@ -155,13 +174,13 @@ template <typename PCS> class ZeroMorphProver_ {
      *
      *                          \zeta_x = q - \sum_k y^k * x^{N - d_k - 1} * q_k
      *
-     * @param batched_quotient
+     * @param batched_quotient \hat{q}, which is updated in place into \zeta_x
      * @param quotients
      * @param y_challenge
      * @param x_challenge
      * @return Polynomial Degree check polynomial \zeta_x such that \zeta_x(x) = 0
      */
-    static Polynomial compute_partially_evaluated_degree_check_polynomial(Polynomial& batched_quotient,
+    static Polynomial compute_partially_evaluated_degree_check_polynomial(Polynomial batched_quotient,
                                                                           std::vector<Polynomial>& quotients,
                                                                           FF y_challenge,
                                                                           FF x_challenge)
@@ -170,7 +189,7 @@ template <typename PCS> class ZeroMorphProver_ {
         size_t log_N = quotients.size();
 
         // Initialize partially evaluated degree check polynomial \zeta_x to \hat{q}
-        auto result = batched_quotient;
+        auto result = std::move(batched_quotient);
 
         auto y_power = FF(1); // y^k
         for (size_t k = 0; k < log_N; ++k) {
@@ -207,8 +226,8 @@ template <typename PCS> class ZeroMorphProver_ {
      * @return Polynomial
      */
     static Polynomial compute_partially_evaluated_zeromorph_identity_polynomial(
-        Polynomial& f_batched,
-        Polynomial& g_batched,
+        const Polynomial& f_batched,
+        Polynomial g_batched,
         std::vector<Polynomial>& quotients,
         FF v_evaluation,
         std::span<const FF> u_challenge,
@@ -218,8 +237,8 @@ template <typename PCS> class ZeroMorphProver_ {
         size_t N = f_batched.size();
         size_t log_N = quotients.size();
 
-        // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i
-        auto result = g_batched;
+        // Initialize Z_x with x * \sum_{i=0}^{m-1} f_i + \sum_{i=0}^{l-1} g_i, reusing the memory of g_batched
+        auto result = std::move(g_batched);
         result.add_scaled(f_batched, x_challenge);
 
         // Compute Z_x -= v * x * \Phi_n(x)
@@ -282,16 +301,16 @@ template <typename PCS> class ZeroMorphProver_ {
      * @param N_max
      * @return Polynomial
      */
-    static Polynomial compute_batched_evaluation_and_degree_check_polynomial(Polynomial& zeta_x,
-                                                                             Polynomial& Z_x,
+    static Polynomial compute_batched_evaluation_and_degree_check_polynomial(Polynomial zeta_x,
+                                                                             const Polynomial& Z_x,
                                                                              FF z_challenge)
     {
         // We cannot commit to polynomials with size > N_max
         size_t N = zeta_x.size();
         ASSERT(N <= N_max);
 
-        // Compute batched polynomial zeta_x + Z_x
-        auto batched_polynomial = zeta_x;
+        // Compute batched polynomial zeta_x + Z_x, reusing the memory of zeta_x
+        auto batched_polynomial = std::move(zeta_x);
         batched_polynomial.add_scaled(Z_x, z_challenge);
 
         // TODO(#742): To complete the degree check, we need to do an opening proof for x_challenge with a univariate
@@ -362,8 +381,8 @@ template <typename PCS> class ZeroMorphProver_ {
 
         size_t num_groups = concatenation_groups.size();
         size_t num_chunks_per_group = concatenation_groups.empty() ? 0 : concatenation_groups[0].size();
-        // Concatenated polynomials
-        Polynomial concatenated_batched(N);
+        // Concatenated polynomials, only allocated if there are any
+        Polynomial concatenated_batched(num_groups > 0 ? N : 0);
 
         // construct concatention_groups_batched
         std::vector<Polynomial> concatenation_groups_batched;
@@ -381,14 +400,42 @@ template <typename PCS> class ZeroMorphProver_ {
             batching_scalar *= rho;
         }
 
-        // Compute the full batched polynomial f = f_batched + g_batched.shifted() = f_batched + h_batched. This is the
-        // polynomial for which we compute the quotients q_k and prove f(u) = v_batched.
-        Polynomial f_polynomial = f_batched;
-        f_polynomial += g_batched.shifted();
-        f_polynomial += concatenated_batched;
-
-        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1})
-        auto quotients = compute_multilinear_quotients(f_polynomial, u_challenge);
+        // Compute the multilinear quotients q_k = q_k(X_0, ..., X_{k-1}) of the full batched polynomial f = f_batched +
+        // g_batched.shifted() = f_batched + h_batched, for which we prove f(u) = v_batched. f is freed as soon as the
+        // quotients are computed.
+        // f is zero outside of the union of the active ranges of its terms, so only that range is stored.
+        size_t f_start = N;
+        size_t f_end = 0;
+        const auto include_range = [&](size_t start, size_t end) {
+            end = std::min(end, N);
+            if (start < end) {
+                f_start = std::min(f_start, start);
+                f_end = std::max(f_end, end);
+            }
+        };
+        for (auto& f_poly : f_polynomials) {
+            include_range(f_poly.start_index(), f_poly.end_index());
+        }
+        for (auto& g_poly : g_polynomials) {
+            // the shift moves the range down by one, the first coefficient of g is zero
+            if (g_poly.end_index() > 0) {
+                include_range(std::max(g_poly.start_index(), size_t{ 1 }) - 1, g_poly.end_index() - 1);
+            }
+        }
+        if (num_groups > 0) {
+            include_range(0, N);
+        }
+        f_start = std::min(f_start, f_end);
+        auto quotients = [&]() {
+            Polynomial f_polynomial(f_end - f_start, N, f_start);
+            f_polynomial += f_batched.view(f_start, f_end - f_start);
+            f_polynomial += g_batched.shifted().view(f_start, f_end - f_start);
+            if (num_groups > 0) {
+                f_polynomial += concatenated_batched;
+            }
+            return compute_multilinear_quotients(f_polynomial, u_challenge);
+        }();
+        concatenated_batched = Polynomial();
 
         // Compute and send commitments C_{q_k} = [q_k], k = 0,...,d-1
         std::vector<Commitment> q_k_commitments;
@@ -413,20 +460,21 @@ template <typename PCS> class ZeroMorphProver_ {
         auto [x_challenge, z_challenge] = transcript->template get_challenges<FF>("ZM:x", "ZM:z");
 
         // Compute degree check polynomial \zeta partially evaluated at x
-        auto zeta_x =
-            compute_partially_evaluated_degree_check_polynomial(batched_quotient, quotients, y_challenge, x_challenge);
+        auto zeta_x = compute_partially_evaluated_degree_check_polynomial(
+            std::move(batched_quotient), quotients, y_challenge, x_challenge);
 
         // Compute ZeroMorph identity polynomial Z partially evaluated at x
         auto Z_x = compute_partially_evaluated_zeromorph_identity_polynomial(f_batched,
-                                                                             g_batched,
+                                                                             std::move(g_batched),
                                                                              quotients,
                                                                              batched_evaluation,
                                                                              u_challenge,
                                                                              x_challenge,
-                                                                             concatenation_groups_batched);
+                                                                             std::move(concatenation_groups_batched));
 
         // Compute batched degree-check and ZM-identity quotient polynomial pi
-        auto pi_polynomial = compute_batched_evaluation_and_degree_check_polynomial(zeta_x, Z_x, z_challenge);
+        auto pi_polynomial =
+            compute_batched_evaluation_and_degree_check_polynomial(std::move(zeta_x), Z_x, z_challenge);
         // Compute opening proof for x_challenge using the underlying univariate PCS
         PCS::compute_opening_proof(
             commitment_key, { .challenge = x_challenge, .evaluation = FF(0) }, pi_polynomial, transcript);
@@ -37,11 +37,12 @@ template <class PCS> class ZeroMorphTest : public CommitmentTest<typename PCS::C
      * polynomials), which are a subset of the f_i. This is what is encountered in practice. We accomplish this using
      * evaluations of h_i but commitments to only their unshifted counterparts g_i (which we get for "free" since
      * commitments [g_i] are contained in the set of commitments [f_i]).
+     * If `structured` is set, the f_i are structured polynomials that only store the middle half of their coefficients.
      *
      */
-    bool execute_zeromorph_protocol(size_t NUM_UNSHIFTED, size_t NUM_SHIFTED)
+    bool execute_zeromorph_protocol(size_t NUM_UNSHIFTED, size_t NUM_SHIFTED, bool structured = false)
     {
-        size_t N = 2;
+        size_t N = structured ? 16 : 2;
         size_t log_N = numeric::get_msb(N);
 
         std::vector<Fr> u_challenge = this->random_evaluation_point(log_N);
@@ -50,8 +51,15 @@ template <class PCS> class ZeroMorphTest : public CommitmentTest<typename PCS::C
         std::vector<Polynomial> f_polynomials; // unshifted polynomials
         std::vector<Fr> v_evaluations;
         for (size_t i = 0; i < NUM_UNSHIFTED; ++i) {
-            f_polynomials.emplace_back(this->random_polynomial(N));
-            f_polynomials[i][0] = Fr(0); // ensure f is "shiftable"
+            if (structured) {
+                f_polynomials.emplace_back(N / 2, N, N / 4);
+                for (size_t j = N / 4; j < 3 * N / 4; ++j) {
+                    f_polynomials[i][j] = Fr::random_element();
+                }
+            } else {
+                f_polynomials.emplace_back(this->random_polynomial(N));
+                f_polynomials[i][0] = Fr(0); // ensure f is "shiftable"
+            }
             v_evaluations.emplace_back(f_polynomials[i].evaluate_mle(u_challenge));
         }
 
@@ -561,6 +569,18 @@ TYPED_TEST(ZeroMorphTest, ProveAndVerifyBatchedWithShifts)
     EXPECT_TRUE(verified);
 }
 
+/**
+ * @brief Test full Prover/Verifier protocol for structured polynomials, which only store their active range
+ *
+ */
+TYPED_TEST(ZeroMorphTest, ProveAndVerifyStructured)
+{
+    size_t num_unshifted = 3;
+    size_t num_shifted = 2;
+    auto verified = this->execute_zeromorph_protocol(num_unshifted, num_shifted, /*structured=*/true);
+    EXPECT_TRUE(verified);
+}
+
 /**
  * @brief Test full Prover/Verifier protocol for proving single multilinear evaluation
  *
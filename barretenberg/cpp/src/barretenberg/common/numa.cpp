@@ -0,0 +1,207 @@
+#include "numa.hpp"
+#include "throw_or_abort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Parses a sysfs list such as "0-3,8-11"
+std::vector<size_t> parse_list(const std::string& list)
+{
+    std::vector<size_t> result;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const auto dash = range.find('-');
+        const size_t first = std::stoul(range.substr(0, dash));
+        const size_t last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+        for (size_t i = first; i <= last; ++i) {
+            result.push_back(i);
+        }
+    }
+    return result;
+}
+
+std::string read_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+struct NumaTopology {
+    // OS ids of the nodes that have CPUs, and the CPUs of each
+    std::vector<size_t> nodes;
+    std::vector<std::vector<size_t>> cpus;
+};
+
+const NumaTopology& get_topology()
+{
+    static const NumaTopology topology = []() {
+        NumaTopology result;
+#ifdef __linux__
+        try {
+            const std::string node_dir = "/sys/devices/system/node/";
+            for (const size_t node : parse_list(read_line(node_dir + "online"))) {
+                auto cpus = parse_list(read_line(node_dir + "node" + std::to_string(node) + "/cpulist"));
+                if (!cpus.empty()) {
+                    result.nodes.push_back(node);
+                    result.cpus.push_back(std::move(cpus));
+                }
+            }
+        } catch (std::exception const&) {
+            result = NumaTopology{};
+        }
+#endif
+        return result;
+    }();
+    return topology;
+}
+
+bb::NumaPolicy policy_from_env()
+{
+    const char* value = std::getenv("BB_NUMA");
+    return (value == nullptr || *value == '\0') ? bb::NumaPolicy::NONE : bb::parse_numa_policy(value);
+}
+
+// Read lazily, so that a bad BB_NUMA value is reported as an error rather than failing static initialisation
+std::atomic<bb::NumaPolicy>& numa_policy()
+{
+    static std::atomic<bb::NumaPolicy> policy = policy_from_env();
+    return policy;
+}
+
+#ifdef __linux__
+// Enough for 1024 nodes
+using NodeMask = std::array<unsigned long, 16>;
+constexpr size_t NODE_MASK_BITS = sizeof(NodeMask) * 8;
+
+void set_node(NodeMask& mask, size_t node)
+{
+    if (node < NODE_MASK_BITS) {
+        mask[node / 64] |= 1UL << (node % 64);
+    }
+}
+
+void bind_pages(uintptr_t begin, uintptr_t end, int mode, const NodeMask& mask)
+{
+    if (begin >= end) {
+        return;
+    }
+    // The kernel reads maxnode - 1 bits of the mask. MPOL_MF_MOVE also migrates pages that were already touched (e.g.
+    // a reused slab). Failure just leaves the default placement.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    (void)syscall(SYS_mbind, begin, end - begin, mode, mask.data(), NODE_MASK_BITS + 1, MPOL_MF_MOVE);
+}
+#endif
+
+} // namespace
+
+namespace bb {
+
+NumaPolicy parse_numa_policy(const std::string& name)
+{
+    if (name == "none") {
+        return NumaPolicy::NONE;
+    }
+    if (name == "interleave") {
+        return NumaPolicy::INTERLEAVE;
+    }
+    if (name == "partition") {
+        return NumaPolicy::PARTITION;
+    }
+    throw_or_abort("Unknown NUMA policy '" + name + "' (expected none, interleave or partition).");
+}
+
+NumaPolicy get_numa_policy()
+{
+    return numa_policy().load(std::memory_order_relaxed);
+}
+
+void set_numa_policy(NumaPolicy policy)
+{
+    numa_policy().store(policy, std::memory_order_relaxed);
+}
+
+size_t get_num_numa_nodes()
+{
+    return std::max(get_topology().nodes.size(), static_cast<size_t>(1));
+}
+
+void numa_place_memory([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size)
+{
+#ifdef __linux__
+    const NumaPolicy policy = get_numa_policy();
+    const auto& topology = get_topology();
+    if (policy == NumaPolicy::NONE || size < NUMA_MIN_PLACEMENT_SIZE || topology.nodes.empty()) {
+        return;
+    }
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto round_down = [page_size](uintptr_t address) { return address - (address % page_size); };
+    // Only pages entirely inside the allocation, so we never move a neighbouring allocation's memory
+    const auto begin = round_down(reinterpret_cast<uintptr_t>(ptr) + page_size - 1);
+    const auto end = round_down(reinterpret_cast<uintptr_t>(ptr) + size);
+    if (begin >= end) {
+        return;
+    }
+
+    if (policy == NumaPolicy::INTERLEAVE) {
+        NodeMask mask{};
+        for (const size_t node : topology.nodes) {
+            set_node(mask, node);
+        }
+        bind_pages(begin, end, MPOL_INTERLEAVE, mask);
+        return;
+    }
+
+    // PARTITION: part k of the range, by numa_node_of, prefers node k. Preferred rather than bound, so a full node
+    // spills over instead of failing the allocation.
+    const size_t num_nodes = topology.nodes.size();
+    const size_t num_pages = (end - begin) / page_size;
+    for (size_t k = 0; k < num_nodes; ++k) {
+        NodeMask mask{};
+        set_node(mask, topology.nodes[k]);
+        const uintptr_t part_begin = begin + ((k * num_pages) / num_nodes) * page_size;
+        const uintptr_t part_end = begin + (((k + 1) * num_pages) / num_nodes) * page_size;
+        bind_pages(part_begin, part_end, MPOL_PREFERRED, mask);
+    }
+#endif
+}
+
+void numa_pin_current_thread([[maybe_unused]] size_t node)
+{
+#ifdef __linux__
+    const auto& topology = get_topology();
+    if (node >= topology.nodes.size()) {
+        return;
+    }
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (const size_t cpu : topology.cpus[node]) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpus);
+        }
+    }
+    (void)sched_setaffinity(0, sizeof(cpus), &cpus);
+#endif
+}
+
+} // namespace bb
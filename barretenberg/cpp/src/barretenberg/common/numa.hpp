@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace bb {
+
+/**
+ * @brief How large prover allocations are placed across NUMA nodes, and whether pool threads are pinned to nodes.
+ *
+ * @details By default memory lands on whichever node first touches it, which for polynomials is usually the thread that
+ * allocated (and zeroed) them, and threads float between sockets. On multi-socket machines that leaves most of a
+ * parallel loop reading memory across the interconnect.
+ *  - INTERLEAVE: large allocations are striped page by page over all nodes, and pool workers are spread evenly over
+ *    the nodes and pinned there. Bandwidth is balanced but half the accesses (on two sockets) are still remote.
+ *  - PARTITION: a large allocation is cut into one contiguous part per node, in node order, and run_loop_in_parallel
+ *    queues each chunk on a worker pinned to the node that holds that part of the data.
+ *
+ * The policy is read from the BB_NUMA environment variable ("none", "interleave" or "partition") unless
+ * set_numa_policy is called first (bb takes it as --numa). It has no effect outside Linux, and placement or pinning
+ * failures (e.g. in a restricted container) are ignored.
+ */
+enum class NumaPolicy { NONE, INTERLEAVE, PARTITION };
+
+NumaPolicy parse_numa_policy(const std::string& name);
+
+NumaPolicy get_numa_policy();
+
+/**
+ * @brief Set the policy. Pool threads are pinned when they start, so call this before any parallel work.
+ */
+void set_numa_policy(NumaPolicy policy);
+
+/**
+ * @brief Number of NUMA nodes with CPUs (1 if the topology is unknown).
+ */
+size_t get_num_numa_nodes();
+
+/**
+ * @brief The node (in 0, ..., get_num_numa_nodes() - 1) owning part `index` of `count` equal parts of a range.
+ * This is the split PARTITION uses for memory, pool workers and loop chunks alike.
+ */
+inline size_t numa_node_of(size_t index, size_t count)
+{
+    return (index * get_num_numa_nodes()) / count;
+}
+
+/**
+ * @brief Apply the current policy to the pages of [ptr, ptr + size). Allocations smaller than
+ * NUMA_MIN_PLACEMENT_SIZE are left alone.
+ */
+void numa_place_memory(void* ptr, size_t size);
+constexpr size_t NUMA_MIN_PLACEMENT_SIZE = 1UL << 20;
+
+/**
+ * @brief Restrict the calling thread to the CPUs of the given node.
+ */
+void numa_pin_current_thread(size_t node);
+
+} // namespace bb
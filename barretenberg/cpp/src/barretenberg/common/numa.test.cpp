@@ -0,0 +1,64 @@
+#include "numa.hpp"
+#include "mem.hpp"
+#include "slab_allocator.hpp"
+#include "thread.hpp"
+#include "thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace bb;
+
+TEST(Numa, ParsePolicy)
+{
+    EXPECT_EQ(parse_numa_policy("none"), NumaPolicy::NONE);
+    EXPECT_EQ(parse_numa_policy("interleave"), NumaPolicy::INTERLEAVE);
+    EXPECT_EQ(parse_numa_policy("partition"), NumaPolicy::PARTITION);
+    EXPECT_THROW(parse_numa_policy("everywhere"), std::runtime_error);
+}
+
+TEST(Numa, NodeOfSplitsEvenly)
+{
+    const size_t num_nodes = get_num_numa_nodes();
+    EXPECT_GE(num_nodes, 1UL);
+    const size_t count = num_nodes * 5 + 3;
+    size_t previous = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const size_t node = numa_node_of(i, count);
+        EXPECT_LT(node, num_nodes);
+        EXPECT_GE(node, previous);
+        previous = node;
+    }
+    EXPECT_EQ(numa_node_of(0, count), 0UL);
+    EXPECT_EQ(numa_node_of(count - 1, count), num_nodes - 1);
+}
+
+// Placement and pinning are best effort, so all we can check on an arbitrary machine is that the results are unchanged
+TEST(Numa, PartitionedLoop)
+{
+    const NumaPolicy original = get_numa_policy();
+    for (const auto policy : { NumaPolicy::INTERLEAVE, NumaPolicy::PARTITION }) {
+        set_numa_policy(policy);
+        const size_t num_elements = NUMA_MIN_PLACEMENT_SIZE / sizeof(uint64_t) * 3 + 5;
+        auto slab = get_mem_slab(num_elements * sizeof(uint64_t));
+        auto* values = static_cast<uint64_t*>(slab.get());
+        run_loop_in_parallel(num_elements, [values](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                values[i] = i * i;
+            }
+        });
+        for (size_t i = 0; i < num_elements; ++i) {
+            ASSERT_EQ(values[i], i * i);
+        }
+    }
+    set_numa_policy(original);
+
+    WorkStealingPool pool(3);
+    std::vector<std::atomic<size_t>> counts(10);
+    pool.parallel_for_numa(counts.size(), [&](size_t i) { counts[i]++; });
+    for (const auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
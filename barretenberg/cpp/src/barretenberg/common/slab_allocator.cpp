@@ -2,9 +2,14 @@
 #include <barretenberg/common/assert.hpp>
 #include <barretenberg/common/log.hpp>
 #include <barretenberg/common/mem.hpp>
+#include <barretenberg/common/numa.hpp>
+#include <algorithm>
+#include <bit>
 #include <cstddef>
 #include <numeric>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 #define LOGGING 0
 
@@ -201,9 +206,207 @@ void SlabAllocator::release(void* ptr, size_t size)
 }
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 SlabAllocator allocator;
+
+/**
+ * Requests are rounded up to one of 8 steps per power of two (so at most 12.5% is wasted), which lets slabs of similar
+ * but not identical sizes, e.g. polynomials of circuit_size and circuit_size + 1, be reused for one another.
+ */
+size_t arena_size_class(size_t size)
+{
+    const size_t step = std::max(static_cast<size_t>(32), std::bit_floor(size) / 8);
+    return std::max((size + step - 1) / step * step, step);
+}
+
+// "polynomials/polynomial.cpp" rather than the full path of the source file
+std::string_view trim_source_path(std::string_view path)
+{
+    const std::string_view root = "barretenberg/";
+    const auto position = path.rfind(root);
+    return position == std::string_view::npos ? path : path.substr(position + root.size());
+}
 } // namespace
 
 namespace bb {
+
+struct SlabArena::State : public std::enable_shared_from_this<SlabArena::State> {
+    using Site = SlabArenaStats::Site;
+
+    // Cleared when the arena is destroyed, after which released slabs go straight back to the heap
+    bool active = true;
+    std::map<size_t, std::vector<void*>> free_slabs;
+    SlabArenaStats totals;
+    std::map<std::pair<std::string_view, uint_least32_t>, Site> sites;
+#ifndef NO_MULTITHREADING
+    std::mutex mutex;
+#endif
+
+    std::shared_ptr<void> get(size_t size, const std::source_location& location);
+    void release(void* ptr, size_t slab_size, Site* site);
+    void free_cached();
+};
+
+std::shared_ptr<void> SlabArena::State::get(size_t size, const std::source_location& location)
+{
+    const size_t slab_size = arena_size_class(size);
+    void* ptr = nullptr;
+    Site* site = nullptr;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        auto it = free_slabs.find(slab_size);
+        if (it != free_slabs.end() && !it->second.empty()) {
+            ptr = it->second.back();
+            it->second.pop_back();
+            totals.cached_bytes -= slab_size;
+            totals.num_reused++;
+        }
+        site = &sites[{ location.file_name(), location.line() }];
+        site->num_allocations++;
+        site->total_bytes += slab_size;
+        site->current_bytes += slab_size;
+        site->peak_bytes = std::max(site->peak_bytes, site->current_bytes);
+        totals.num_allocations++;
+        totals.total_bytes += slab_size;
+        totals.current_bytes += slab_size;
+        totals.peak_bytes = std::max(totals.peak_bytes, totals.current_bytes);
+    }
+    if (ptr == nullptr) {
+        ptr = aligned_alloc(32, slab_size);
+    }
+    return { ptr, [state = shared_from_this(), slab_size, site](void* p) { state->release(p, slab_size, site); } };
+}
+
+void SlabArena::State::release(void* ptr, size_t slab_size, Site* site)
+{
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        site->current_bytes -= slab_size;
+        totals.current_bytes -= slab_size;
+        if (active) {
+            free_slabs[slab_size].push_back(ptr);
+            totals.cached_bytes += slab_size;
+            return;
+        }
+    }
+    aligned_free(ptr);
+}
+
+void SlabArena::State::free_cached()
+{
+    std::map<size_t, std::vector<void*>> to_free;
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(mutex);
+#endif
+        active = false;
+        to_free.swap(free_slabs);
+        totals.cached_bytes = 0;
+    }
+    for (auto& e : to_free) {
+        for (auto* p : e.second) {
+            aligned_free(p);
+        }
+    }
+}
+} // namespace bb
+
+namespace {
+// The innermost live arena, if any
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+bb::SlabArena* current_arena = nullptr;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::shared_ptr<bb::SlabArena::State> current_arena_state;
+#ifndef NO_MULTITHREADING
+std::mutex current_arena_mutex;
+#endif
+
+std::shared_ptr<bb::SlabArena::State> get_current_arena_state()
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(current_arena_mutex);
+#endif
+    return current_arena_state;
+}
+} // namespace
+
+namespace bb {
+SlabArena::SlabArena()
+    : state(std::make_shared<State>())
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(current_arena_mutex);
+#endif
+    parent = current_arena;
+    current_arena = this;
+    current_arena_state = state;
+}
+
+SlabArena::~SlabArena()
+{
+    {
+#ifndef NO_MULTITHREADING
+        std::unique_lock<std::mutex> lock(current_arena_mutex);
+#endif
+        current_arena = parent;
+        current_arena_state = parent == nullptr ? nullptr : parent->state;
+    }
+    state->free_cached();
+}
+
+SlabArenaStats SlabArena::get_stats() const
+{
+#ifndef NO_MULTITHREADING
+    std::unique_lock<std::mutex> lock(state->mutex);
+#endif
+    SlabArenaStats stats = state->totals;
+    for (const auto& [location, site] : state->sites) {
+        // Sites in headers are seen from several translation units
+        auto& merged = stats.sites[std::string(trim_source_path(location.first)) + ":" +
+                                   std::to_string(location.second)];
+        merged.num_allocations += site.num_allocations;
+        merged.total_bytes += site.total_bytes;
+        merged.current_bytes += site.current_bytes;
+        merged.peak_bytes = std::max(merged.peak_bytes, site.peak_bytes);
+    }
+    return stats;
+}
+
+void SlabArena::print_stats(size_t max_sites) const
+{
+    constexpr double MiB = 1024.0 * 1024.0;
+    const auto stats = get_stats();
+    info("slab arena: peak ",
+         static_cast<double>(stats.peak_bytes) / MiB,
+         " MiB, current ",
+         static_cast<double>(stats.current_bytes) / MiB,
+         " MiB, cached ",
+         static_cast<double>(stats.cached_bytes) / MiB,
+         " MiB, ",
+         stats.num_allocations,
+         " allocations (",
+         stats.num_reused,
+         " reused)");
+    std::vector<std::pair<std::string, SlabArenaStats::Site>> sites(stats.sites.begin(), stats.sites.end());
+    std::sort(sites.begin(), sites.end(), [](const auto& a, const auto& b) {
+        return a.second.peak_bytes > b.second.peak_bytes;
+    });
+    sites.resize(std::min(sites.size(), max_sites));
+    for (const auto& [location, site] : sites) {
+        info("  ",
+             location,
+             ": peak ",
+             static_cast<double>(site.peak_bytes) / MiB,
+             " MiB, ",
+             site.num_allocations,
+             " allocations totalling ",
+             static_cast<double>(site.total_bytes) / MiB,
+             " MiB");
+    }
+}
+
 void init_slab_allocator(size_t circuit_subgroup_size)
 {
     allocator.init(circuit_subgroup_size);
@@ -214,14 +417,17 @@ void init_slab_allocator(size_t circuit_subgroup_size)
 //     return 0;
 // })();
 
-std::shared_ptr<void> get_mem_slab(size_t size)
+std::shared_ptr<void> get_mem_slab(size_t size, std::source_location location)
 {
-    return allocator.get(size);
+    auto arena_state = get_current_arena_state();
+    auto slab = arena_state ? arena_state->get(size, location) : allocator.get(size);
+    numa_place_memory(slab.get(), size);
+    return slab;
 }
 
-void* get_mem_slab_raw(size_t size)
+void* get_mem_slab_raw(size_t size, std::source_location location)
 {
-    auto slab = get_mem_slab(size);
+    auto slab = get_mem_slab(size, location);
 #ifndef NO_MULTITHREADING
     std::unique_lock<std::mutex> lock(manual_slabs_mutex);
 #endif
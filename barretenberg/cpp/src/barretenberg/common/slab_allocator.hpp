@@ -4,6 +4,8 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <source_location>
+#include <string>
 #include <unordered_map>
 #ifndef NO_MULTITHREADING
 #include <mutex>
@@ -28,19 +30,73 @@ namespace bb {
 void init_slab_allocator(size_t circuit_subgroup_size);
 
 /**
- * Returns a slab from the preallocated pool of slabs, or fallback to a new heap allocation (32 byte aligned).
- * Ref counted result so no need to manually free.
+ * Returns a slab from the current SlabArena if there is one, else from the preallocated pool of slabs, or fallback to a
+ * new heap allocation (32 byte aligned).
+ * Ref counted result so no need to manually free. The location is only used for the arena's statistics.
  */
-std::shared_ptr<void> get_mem_slab(size_t size);
+std::shared_ptr<void> get_mem_slab(size_t size, std::source_location location = std::source_location::current());
 
 /**
  * Sometimes you want a raw pointer to a slab so you can manage when it's released manually (e.g. c_binds, containers).
  * This still gets a slab with a shared_ptr, but holds the shared_ptr internally until free_mem_slab_raw is called.
  */
-void* get_mem_slab_raw(size_t size);
+void* get_mem_slab_raw(size_t size, std::source_location location = std::source_location::current());
 
 void free_mem_slab_raw(void*);
 
+/**
+ * Memory usage of a SlabArena. Sizes are in bytes, after rounding requests up to the arena's size classes.
+ */
+struct SlabArenaStats {
+    struct Site {
+        size_t num_allocations = 0;
+        size_t total_bytes = 0;
+        size_t current_bytes = 0;
+        size_t peak_bytes = 0;
+    };
+
+    size_t num_allocations = 0;
+    // Allocations served from slabs released earlier in the arena's lifetime
+    size_t num_reused = 0;
+    size_t total_bytes = 0;
+    size_t current_bytes = 0;
+    size_t peak_bytes = 0;
+    // Released slabs the arena holds on to for reuse (not included in current_bytes)
+    size_t cached_bytes = 0;
+    // Keyed by "file:line" of the allocating call
+    std::map<std::string, Site> sites;
+};
+
+/**
+ * Scopes the memory of a proof. While a SlabArena is alive, get_mem_slab draws from it (from any thread, so allocations
+ * in parallel loops are included). A released slab is kept by the arena and handed out again for a later request of
+ * the same size class, rather than going back to the heap, and usage is tracked per call site. Destroying the arena
+ * frees everything it has cached in one go, so back-to-back proofs in one process each start from a clean heap.
+ *
+ * Slabs still referenced when the arena is destroyed stay valid, and are freed as usual once released. Arenas nest (the
+ * innermost one is used), but are process-wide: two proofs constructed concurrently share the innermost arena.
+ */
+class SlabArena {
+  public:
+    SlabArena();
+    SlabArena(const SlabArena& other) = delete;
+    SlabArena(SlabArena&& other) = delete;
+    SlabArena& operator=(const SlabArena& other) = delete;
+    SlabArena& operator=(SlabArena&& other) = delete;
+    ~SlabArena();
+
+    SlabArenaStats get_stats() const;
+
+    // Logs the totals, and the call sites with the highest peak usage
+    void print_stats(size_t max_sites = 16) const;
+
+    struct State;
+
+  private:
+    std::shared_ptr<State> state;
+    SlabArena* parent;
+};
+
 /**
  * Allocator for containers such as std::vector. Makes them leverage the underlying slab allocator where possible.
  */
@@ -0,0 +1,69 @@
+#include "slab_allocator.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace bb;
+
+TEST(SlabArena, ReusesReleasedSlabs)
+{
+    SlabArena arena;
+    void* first = nullptr;
+    {
+        auto slab = get_mem_slab(1000);
+        first = slab.get();
+        std::memset(slab.get(), 1, 1000);
+    }
+    // 1000 and 1010 bytes share a size class
+    auto slab = get_mem_slab(1010);
+    EXPECT_EQ(slab.get(), first);
+
+    const auto stats = arena.get_stats();
+    EXPECT_EQ(stats.num_allocations, 2);
+    EXPECT_EQ(stats.num_reused, 1);
+    EXPECT_GE(stats.current_bytes, 1010);
+    EXPECT_EQ(stats.peak_bytes, stats.current_bytes);
+    EXPECT_EQ(stats.cached_bytes, 0);
+}
+
+TEST(SlabArena, TracksPeakAndCallSites)
+{
+    SlabArena arena;
+    {
+        auto a = get_mem_slab(1 << 16);
+        auto b = get_mem_slab(1 << 16);
+    }
+    auto c = get_mem_slab(1 << 10);
+
+    const auto stats = arena.get_stats();
+    EXPECT_EQ(stats.peak_bytes, 2 << 16);
+    EXPECT_EQ(stats.current_bytes, 1 << 10);
+    EXPECT_EQ(stats.cached_bytes, 2 << 16);
+    EXPECT_EQ(stats.total_bytes, (2 << 16) + (1 << 10));
+    // a and b are allocated on different lines
+    ASSERT_EQ(stats.sites.size(), 3);
+    for (const auto& [location, site] : stats.sites) {
+        EXPECT_NE(location.find("slab_allocator.test.cpp:"), std::string::npos);
+        EXPECT_EQ(site.num_allocations, 1);
+    }
+}
+
+TEST(SlabArena, NestedArenasAndOutstandingSlabs)
+{
+    std::shared_ptr<void> outstanding;
+    {
+        SlabArena outer;
+        {
+            SlabArena inner;
+            outstanding = get_mem_slab(4096);
+            std::memset(outstanding.get(), 2, 4096);
+            EXPECT_EQ(inner.get_stats().num_allocations, 1);
+        }
+        // the slab outlives the inner arena
+        EXPECT_EQ(static_cast<uint8_t*>(outstanding.get())[4095], 2);
+        auto slab = get_mem_slab(64);
+        EXPECT_EQ(outer.get_stats().num_allocations, 1);
+    }
+    outstanding.reset();
+}
@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include "numa.hpp"
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,6 +35,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above are flat fork-joins, so a parallel_for issued from inside another one (or concurrently
+ * from another thread) can't make use of the machine. "work_stealing" (see thread_pool.hpp) is a persistent pool with
+ * per-thread queues that handles both, and matches mutex_pool on flat loops (see thread_pool_bench). It is now the
+ * default.
  */
 
 namespace bb {
@@ -69,6 +75,10 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
+void parallel_for_numa(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,12 +92,30 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
 
+namespace {
+/**
+ * @brief parallel_for over the chunks of a loop split evenly across threads. With the PARTITION NUMA policy, chunk i
+ * runs on the node holding the i-th part of large allocations.
+ */
+void parallel_for_chunks(size_t num_chunks, const std::function<void(size_t)>& func)
+{
+#ifndef NO_MULTITHREADING
+    if (get_numa_policy() == NumaPolicy::PARTITION) {
+        parallel_for_numa(num_chunks, func);
+        return;
+    }
+#endif
+    parallel_for(num_chunks, func);
+}
+} // namespace
+
 /**
  * @brief Split a loop into several loops running in parallel
  *
@@ -113,7 +141,7 @@ void run_loop_in_parallel(size_t num_points,
     // Compute the size of a single chunk
     const size_t chunk_size = (num_points / num_cpus) + (num_points % num_cpus == 0 ? 0 : 1);
     // Parallelize over chunks
-    parallel_for(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
+    parallel_for_chunks(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
         // If num_points is small, sometimes we need fewer CPUs
         if (chunk_size * chunk_index > num_points) {
             return;
@@ -200,7 +228,7 @@ void run_loop_in_parallel_if_effective_internal(size_t num_points,
         return;
     }
     // Parallelize over chunks
-    parallel_for(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
+    parallel_for_chunks(num_cpus, [num_points, chunk_size, &func](size_t chunk_index) {
         // If num_points is small, sometimes we need fewer CPUs
         if (chunk_size * chunk_index > num_points) {
             return;
@@ -0,0 +1,133 @@
+/**
+ * @file thread_pool.bench.cpp
+ * @brief Compares the parallel_for backends on flat loops, and the work-stealing pool on the nested and concurrent
+ * loops the flat backends can't run in parallel.
+ */
+#include "thread.hpp"
+#include "thread_pool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace benchmark;
+
+namespace bb {
+void parallel_for_moody(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+
+using namespace bb;
+
+namespace {
+
+using ParallelFor = void (*)(size_t, const std::function<void(size_t)>&);
+
+// A few hundred nanoseconds of work that the compiler can't optimise away
+uint64_t work(uint64_t seed, size_t num_steps)
+{
+    uint64_t x = seed;
+    for (size_t i = 0; i < num_steps; ++i) {
+        x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return x;
+}
+
+/**
+ * @brief One parallel_for over 2^range(0) iterations of work(·, range(1)): the overhead of starting a loop for small
+ * iteration counts, and the scaling for large ones.
+ */
+void flat_loop(State& state, ParallelFor backend)
+{
+    const auto num_iterations = static_cast<size_t>(1) << static_cast<size_t>(state.range(0));
+    const auto num_steps = static_cast<size_t>(state.range(1));
+    std::vector<uint64_t> results(num_iterations);
+    for (auto _ : state) {
+        backend(num_iterations, [&](size_t i) { results[i] = work(i, num_steps); });
+        DoNotOptimize(results.data());
+    }
+}
+
+/**
+ * @brief An outer loop with few, uneven iterations, each of which is itself a parallel loop. The flat backends have to
+ * run the inner loops sequentially (a nested call would deadlock or clobber the running loop).
+ */
+void nested_loop(State& state, bool nested_parallelism)
+{
+    constexpr size_t OUTER = 4;
+    constexpr size_t INNER = 1 << 10;
+    std::vector<uint64_t> results(OUTER * INNER);
+    for (auto _ : state) {
+        parallel_for_work_stealing(OUTER, [&](size_t i) {
+            const auto inner = [&](size_t j) { results[i * INNER + j] = work(j, 100 * (i + 1)); };
+            if (nested_parallelism) {
+                parallel_for_work_stealing(INNER, inner);
+            } else {
+                for (size_t j = 0; j < INNER; ++j) {
+                    inner(j);
+                }
+            }
+        });
+        DoNotOptimize(results.data());
+    }
+}
+
+/**
+ * @brief Two threads issuing parallel loops at the same time, e.g. two provers sharing a machine. With the flat pools
+ * they take turns; the work-stealing pool interleaves them.
+ */
+void concurrent_loops(State& state, ParallelFor backend)
+{
+    constexpr size_t NUM_CALLERS = 2;
+    constexpr size_t NUM_LOOPS = 16;
+    constexpr size_t NUM_ITERATIONS = 1 << 10;
+    std::vector<std::vector<uint64_t>> results(NUM_CALLERS, std::vector<uint64_t>(NUM_ITERATIONS));
+    for (auto _ : state) {
+        std::vector<std::thread> callers;
+        for (size_t c = 0; c < NUM_CALLERS; ++c) {
+            callers.emplace_back([&, c]() {
+                for (size_t loop = 0; loop < NUM_LOOPS; ++loop) {
+                    backend(NUM_ITERATIONS, [&](size_t i) { results[c][i] = work(i + loop, 100); });
+                }
+            });
+        }
+        for (auto& caller : callers) {
+            caller.join();
+        }
+        DoNotOptimize(results.data());
+    }
+}
+
+// The flat pools can't run two loops at once, so the callers have to take turns
+void concurrent_loops_serialised(State& state)
+{
+    static std::mutex mutex;
+    concurrent_loops(state, [](size_t num_iterations, const std::function<void(size_t)>& func) {
+        std::unique_lock<std::mutex> lock(mutex);
+        parallel_for_mutex_pool(num_iterations, func);
+    });
+}
+
+} // namespace
+
+#define FLAT_LOOP_ARGS ArgsProduct({ { 4, 10, 16 }, { 10, 1000 } })->Unit(kMicrosecond)
+BENCHMARK_CAPTURE(flat_loop, mutex_pool, &parallel_for_mutex_pool)->FLAT_LOOP_ARGS;
+BENCHMARK_CAPTURE(flat_loop, atomic_pool, &parallel_for_atomic_pool)->FLAT_LOOP_ARGS;
+BENCHMARK_CAPTURE(flat_loop, moody, &parallel_for_moody)->FLAT_LOOP_ARGS;
+BENCHMARK_CAPTURE(flat_loop, queued, &parallel_for_queued)->FLAT_LOOP_ARGS;
+BENCHMARK_CAPTURE(flat_loop, spawning, &parallel_for_spawning)->FLAT_LOOP_ARGS;
+BENCHMARK_CAPTURE(flat_loop, work_stealing, &parallel_for_work_stealing)->FLAT_LOOP_ARGS;
+BENCHMARK_CAPTURE(nested_loop, sequential_inner, false)->Unit(kMicrosecond);
+BENCHMARK_CAPTURE(nested_loop, parallel_inner, true)->Unit(kMicrosecond);
+BENCHMARK(concurrent_loops_serialised)->Unit(kMicrosecond)->UseRealTime();
+BENCHMARK_CAPTURE(concurrent_loops, work_stealing, &parallel_for_work_stealing)->Unit(kMicrosecond)->UseRealTime();
+BENCHMARK_MAIN();
@@ -0,0 +1,260 @@
+#include "thread_pool.hpp"
+#include "thread.hpp"
+
+#include "barretenberg/common/compiler_hints.hpp"
+#include "numa.hpp"
+
+#include <algorithm>
+
+namespace {
+// The pool (if any) the current thread is a worker of, and its index in that pool
+thread_local bb::WorkStealingPool* current_pool = nullptr;
+thread_local size_t current_worker_index = 0;
+
+// How many times an idle worker looks for work before going to sleep
+constexpr size_t MAX_IDLE_SPINS = 1 << 10;
+} // namespace
+
+namespace bb {
+
+WorkStealingPool::WorkStealingPool(size_t num_workers)
+{
+    queues.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+WorkStealingPool& WorkStealingPool::global()
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+    return pool;
+}
+
+size_t WorkStealingPool::local_queue_index() const
+{
+    return (current_pool == this) ? current_worker_index : workers.size();
+}
+
+void WorkStealingPool::post(Task task, TaskPriority priority)
+{
+    if (workers.empty()) {
+        task();
+        return;
+    }
+    push(local_queue_index(), task, priority, 1);
+}
+
+void WorkStealingPool::push(size_t queue_index, const Task& task, TaskPriority priority, size_t count)
+{
+    TaskQueue& queue = *queues[queue_index];
+    {
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        auto& tasks = queue.tasks[static_cast<size_t>(priority)];
+        for (size_t i = 0; i < count; ++i) {
+            tasks.push_back(task);
+        }
+        queue.size += count;
+    }
+    num_queued += count;
+    // Taking the lock orders the increment of num_queued with a worker checking it before going to sleep, so the
+    // notification cannot be lost
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+    }
+    if (count == 1) {
+        sleep_condition.notify_one();
+    } else {
+        sleep_condition.notify_all();
+    }
+}
+
+/**
+ * @brief Find the highest priority task available to a thread whose own queue is `queue_index`. Tasks are taken from
+ * the back of the thread's own queue and stolen from the front of the others.
+ */
+bool WorkStealingPool::try_pop(size_t queue_index, Task& task)
+{
+    if (num_queued.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    const size_t num_queues = queues.size();
+    for (size_t priority = 0; priority < NUM_PRIORITIES; ++priority) {
+        for (size_t i = 0; i < num_queues; ++i) {
+            const size_t index = (queue_index + i) % num_queues;
+            TaskQueue& queue = *queues[index];
+            if (queue.size.load(std::memory_order_relaxed) == 0) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            auto& tasks = queue.tasks[priority];
+            if (tasks.empty()) {
+                continue;
+            }
+            if (index == queue_index) {
+                task = std::move(tasks.back());
+                tasks.pop_back();
+            } else {
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            --queue.size;
+            --num_queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::help_until(const std::function<bool()>& done)
+{
+    const size_t queue_index = local_queue_index();
+    Task task;
+    while (!done()) {
+        if (try_pop(queue_index, task)) {
+            task();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void WorkStealingPool::parallel_for(size_t num_iterations,
+                                    const std::function<void(size_t)>& func,
+                                    TaskPriority priority)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    if (workers.empty() || num_iterations == 1) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    struct Loop {
+        const std::function<void(size_t)>* func;
+        size_t num_iterations;
+        std::atomic<size_t> next_iteration = 0;
+        std::atomic<size_t> iterations_completed = 0;
+    };
+    // Helper tasks can outlive this call (they may only be picked up once the loop is done), so they share ownership
+    // of the loop state. They never touch `func` unless they claim an iteration, which can't happen after we return.
+    auto loop = std::make_shared<Loop>();
+    loop->func = &func;
+    loop->num_iterations = num_iterations;
+    const auto run_iterations = [](Loop& loop) {
+        size_t completed = 0;
+        for (size_t i = loop.next_iteration++; i < loop.num_iterations; i = loop.next_iteration++) {
+            (*loop.func)(i);
+            ++completed;
+        }
+        if (completed > 0) {
+            loop.iterations_completed.fetch_add(completed, std::memory_order_release);
+        }
+    };
+
+    const size_t num_helpers = std::min(num_iterations - 1, workers.size());
+    push(local_queue_index(), [loop, run_iterations]() { run_iterations(*loop); }, priority, num_helpers);
+
+    run_iterations(*loop);
+    help_until([&loop, num_iterations]() {
+        return loop->iterations_completed.load(std::memory_order_acquire) == num_iterations;
+    });
+}
+
+void WorkStealingPool::parallel_for_numa(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    const size_t num_workers = workers.size();
+    if (num_workers == 0 || num_iterations <= 1) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    const size_t num_nodes = get_num_numa_nodes();
+    std::atomic<size_t> iterations_completed = 0;
+    for (size_t i = 0; i < num_iterations; ++i) {
+        // The workers pinned to a node are the ones with numa_node_of(w, num_workers) == node
+        const size_t node = numa_node_of(i, num_iterations);
+        const size_t first = (node * num_workers + num_nodes - 1) / num_nodes;
+        const size_t last = ((node + 1) * num_workers + num_nodes - 1) / num_nodes;
+        const size_t worker = last > first ? first + (i % (last - first)) : i % num_workers;
+        push(
+            worker,
+            [&func, &iterations_completed, i]() {
+                func(i);
+                iterations_completed.fetch_add(1, std::memory_order_release);
+            },
+            TaskPriority::NORMAL,
+            1);
+    }
+    help_until([&iterations_completed, num_iterations]() {
+        return iterations_completed.load(std::memory_order_acquire) == num_iterations;
+    });
+}
+
+BB_NO_PROFILE void WorkStealingPool::worker_loop(size_t worker_index)
+{
+    current_pool = this;
+    current_worker_index = worker_index;
+    if (get_numa_policy() != NumaPolicy::NONE) {
+        // the queues (one per worker plus the injection queue) are all in place before any worker starts
+        numa_pin_current_thread(numa_node_of(worker_index, queues.size() - 1));
+    }
+    Task task;
+    size_t idle_spins = 0;
+    while (true) {
+        if (try_pop(worker_index, task)) {
+            task();
+            // release whatever the task captured before we go to sleep
+            task = nullptr;
+            idle_spins = 0;
+            continue;
+        }
+        if (++idle_spins < MAX_IDLE_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle_spins = 0;
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleep_condition.wait(lock, [this] { return stop || num_queued > 0; });
+        if (stop) {
+            break;
+        }
+    }
+}
+
+/**
+ * A persistent work-stealing pool (see WorkStealingPool). Unlike the other backends, nested calls run in parallel
+ * rather than deadlocking or serialising, and concurrent calls from different threads share the workers.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    WorkStealingPool::global().parallel_for(num_iterations, func);
+}
+
+void parallel_for_numa(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    WorkStealingPool::global().parallel_for_numa(num_iterations, func);
+}
+
+} // namespace bb
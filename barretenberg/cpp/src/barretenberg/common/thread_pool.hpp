@@ -0,0 +1,131 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Priority of a task in the WorkStealingPool. Higher priority tasks are always picked (and stolen) first.
+ */
+enum class TaskPriority : size_t { HIGH = 0, NORMAL = 1, LOW = 2 };
+
+/**
+ * @brief A persistent thread pool with per-worker task queues and work stealing.
+ *
+ * @details The `parallel_for` backends in this directory are flat fork-joins: a call hands one range to every thread
+ * and blocks until it is done, and a `parallel_for` issued from inside another one either deadlocks or runs
+ * sequentially. Here every worker owns a deque of tasks per priority level. A worker pushes and pops its own tasks at
+ * the back (so nested work stays hot in its cache) and, when it runs dry, steals from the front of the other queues.
+ * Threads that are not workers of the pool submit into a shared injection queue.
+ *
+ * A thread that waits on the pool (in `parallel_for`, `wait` or `help_until`) executes queued tasks until the thing it
+ * waits for is done, rather than blocking. This is what makes nested parallelism safe, and lets independent pieces of
+ * work (e.g. from different provers) interleave on the same set of threads instead of each call claiming the whole
+ * machine.
+ */
+class WorkStealingPool {
+  public:
+    using Task = std::function<void()>;
+    static constexpr size_t NUM_PRIORITIES = 3;
+
+    explicit WorkStealingPool(size_t num_workers);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    /**
+     * @brief The process-wide pool backing `parallel_for`. It has get_num_cpus() - 1 workers, as the calling thread
+     * takes part in the work.
+     */
+    static WorkStealingPool& global();
+
+    size_t num_workers() const { return workers.size(); }
+
+    /**
+     * @brief Queue a task. If the pool has no workers, the task is run immediately.
+     */
+    void post(Task task, TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * @brief Queue a task and return a future for its result. Use `wait` rather than `future.get()` to wait on it from
+     * inside the pool, so that the waiting thread keeps doing useful work.
+     */
+    template <typename Func>
+    std::future<std::invoke_result_t<Func>> submit(Func&& func, TaskPriority priority = TaskPriority::NORMAL)
+    {
+        using Result = std::invoke_result_t<Func>;
+        // std::function needs a copyable callable, and packaged_task is move-only
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> future = task->get_future();
+        post([task]() { (*task)(); }, priority);
+        return future;
+    }
+
+    /**
+     * @brief Run queued tasks until the future is ready, then return its value.
+     */
+    template <typename T> T wait(std::future<T>& future)
+    {
+        help_until([&future]() { return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; });
+        return future.get();
+    }
+
+    /**
+     * @brief Run func(0), ..., func(num_iterations - 1) on the pool and return when all have completed.
+     *
+     * @details Iterations are claimed one at a time from a shared counter, by the calling thread and by up to
+     * num_workers() helper tasks, so uneven iterations balance out. Safe to call from inside a task.
+     */
+    void parallel_for(size_t num_iterations,
+                      const std::function<void(size_t)>& func,
+                      TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     * @brief As parallel_for, but iteration i is queued on a worker pinned to the NUMA node numa_node_of(i,
+     * num_iterations), i.e. the node that holds the i-th part of a partitioned allocation (see numa.hpp). Idle workers
+     * on other nodes may still steal it.
+     */
+    void parallel_for_numa(size_t num_iterations, const std::function<void(size_t)>& func);
+
+    /**
+     * @brief Execute queued tasks until done() returns true.
+     */
+    void help_until(const std::function<bool()>& done);
+
+  private:
+    struct TaskQueue {
+        std::mutex mutex;
+        std::array<std::deque<Task>, NUM_PRIORITIES> tasks;
+        // lets thieves skip empty queues without taking the lock
+        std::atomic<size_t> size = 0;
+    };
+
+    // one queue per worker, followed by the injection queue for threads outside the pool
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> num_queued = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+
+    size_t local_queue_index() const;
+    void push(size_t queue_index, const Task& task, TaskPriority priority, size_t count);
+    bool try_pop(size_t queue_index, Task& task);
+    void worker_loop(size_t worker_index);
+};
+
+} // namespace bb
@@ -0,0 +1,147 @@
+#include "thread_pool.hpp"
+#include "thread.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+TEST(WorkStealingPool, ParallelForRunsEachIterationOnce)
+{
+    WorkStealingPool pool(4);
+    for (const size_t num_iterations : std::vector<size_t>{ 0, 1, 3, 1000 }) {
+        std::vector<std::atomic<size_t>> counts(num_iterations);
+        pool.parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+        for (const auto& count : counts) {
+            EXPECT_EQ(count, 1);
+        }
+    }
+}
+
+TEST(WorkStealingPool, NestedParallelFor)
+{
+    WorkStealingPool pool(3);
+    constexpr size_t OUTER = 16;
+    constexpr size_t INNER = 64;
+    std::vector<std::atomic<size_t>> counts(OUTER * INNER);
+    pool.parallel_for(OUTER, [&](size_t i) {
+        pool.parallel_for(INNER, [&](size_t j) {
+            pool.parallel_for(2, [&](size_t k) {
+                if (k == 0) {
+                    counts[i * INNER + j]++;
+                }
+            });
+        });
+    });
+    for (const auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST(WorkStealingPool, ConcurrentCallersShareThePool)
+{
+    WorkStealingPool pool(2);
+    constexpr size_t NUM_CALLERS = 4;
+    constexpr size_t NUM_ITERATIONS = 500;
+    std::vector<std::vector<size_t>> results(NUM_CALLERS, std::vector<size_t>(NUM_ITERATIONS, 0));
+    std::vector<std::thread> callers;
+    for (size_t c = 0; c < NUM_CALLERS; ++c) {
+        callers.emplace_back([&, c]() { pool.parallel_for(NUM_ITERATIONS, [&](size_t i) { results[c][i] = c + i; }); });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (size_t c = 0; c < NUM_CALLERS; ++c) {
+        for (size_t i = 0; i < NUM_ITERATIONS; ++i) {
+            EXPECT_EQ(results[c][i], c + i);
+        }
+    }
+}
+
+TEST(WorkStealingPool, FuturesAndWaitingInsideTasks)
+{
+    WorkStealingPool pool(2);
+    // each task waits on futures of its own subtasks, which only works if waiting threads keep running tasks
+    std::function<size_t(size_t)> sum_range = [&](size_t n) -> size_t {
+        if (n <= 4) {
+            return n * (n + 1) / 2;
+        }
+        auto lower = pool.submit([&, n]() { return sum_range(n / 2); });
+        size_t upper = 0;
+        for (size_t i = n / 2 + 1; i <= n; ++i) {
+            upper += i;
+        }
+        return pool.wait(lower) + upper;
+    };
+    auto result = pool.submit([&]() { return sum_range(1000); });
+    EXPECT_EQ(pool.wait(result), 500500UL);
+
+    auto failing = pool.submit([]() -> size_t { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(pool.wait(failing), std::runtime_error);
+}
+
+TEST(WorkStealingPool, HigherPriorityTasksRunFirst)
+{
+    WorkStealingPool pool(1);
+    // occupy the only worker while we queue up tasks
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::atomic<bool> blocking_started = false;
+    pool.post([&]() {
+        blocking_started = true;
+        released.wait();
+    });
+    while (!blocking_started) {
+        std::this_thread::yield();
+    }
+
+    std::vector<TaskPriority> order;
+    std::mutex order_mutex;
+    std::vector<std::future<void>> futures;
+    for (const auto priority : { TaskPriority::LOW, TaskPriority::NORMAL, TaskPriority::HIGH }) {
+        futures.emplace_back(pool.submit(
+            [&, priority]() {
+                std::unique_lock<std::mutex> lock(order_mutex);
+                order.push_back(priority);
+            },
+            priority));
+    }
+    release.set_value();
+    for (auto& future : futures) {
+        future.wait();
+    }
+    EXPECT_EQ(order, (std::vector<TaskPriority>{ TaskPriority::HIGH, TaskPriority::NORMAL, TaskPriority::LOW }));
+}
+
+TEST(WorkStealingPool, NoWorkers)
+{
+    WorkStealingPool pool(0);
+    std::vector<size_t> values(100, 0);
+    pool.parallel_for(values.size(), [&](size_t i) { values[i] = i; });
+    std::vector<size_t> expected(100);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(values, expected);
+
+    auto future = pool.submit([]() { return 42; });
+    EXPECT_EQ(pool.wait(future), 42);
+}
+
+TEST(WorkStealingPool, GlobalParallelFor)
+{
+    std::vector<std::atomic<size_t>> counts(get_num_cpus() * 8);
+    parallel_for(counts.size(), [&](size_t i) {
+        parallel_for(4, [&](size_t j) {
+            if (j == 3) {
+                counts[i]++;
+            }
+        });
+    });
+    for (const auto& count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
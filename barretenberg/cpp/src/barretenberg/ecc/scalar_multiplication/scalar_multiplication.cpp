@@ -1,13 +1,17 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
@@ -115,6 +119,55 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
     }
 }
 
+/**
+ * @brief Precompute the multiples of the points needed by `pippenger_fixed_base_unsafe`.
+ *
+ * @details For each point Pᵢ and each digit position r of a signed `window_bits`-bit decomposition of a 128-bit
+ * endomorphism scalar, we store 2^{r⋅window_bits}⋅Pᵢ at `table[i * num_rounds + r]`. The endomorphism points are not
+ * stored, as they can be recovered with one multiplication by β. The table holds `num_points *
+ * get_num_signed_digit_rounds(window_bits)` points.
+ *
+ * @param points The pippenger point table (i.e. the output of `generate_pippenger_point_table`)
+ * @param table Output
+ * @param num_points The number of points before the endomorphism split
+ * @param window_bits The bit width of the signed digits, i.e. there are 2^{window_bits - 1} buckets per MSM
+ */
+template <typename Curve>
+void generate_fixed_base_table(const typename Curve::AffineElement* points,
+                               typename Curve::AffineElement* table,
+                               const size_t num_points,
+                               const size_t window_bits)
+{
+    using Element = typename Curve::Element;
+    // normalise the multiples of this many points with a single batch inversion
+    constexpr size_t BLOCK_SIZE = 64;
+
+    ASSERT(window_bits >= 2 && window_bits <= 24);
+    const size_t num_rounds = get_num_signed_digit_rounds(window_bits);
+    const size_t num_blocks = (num_points + BLOCK_SIZE - 1) / BLOCK_SIZE;
+    run_loop_in_parallel(num_blocks, [&](size_t block_start, size_t block_end) {
+        std::vector<Element> multiples(BLOCK_SIZE * num_rounds);
+        for (size_t block = block_start; block < block_end; ++block) {
+            const size_t start = block * BLOCK_SIZE;
+            const size_t end = std::min(start + BLOCK_SIZE, num_points);
+            for (size_t i = start; i < end; ++i) {
+                Element accumulator(points[i * 2]);
+                for (size_t round = 0; round < num_rounds; ++round) {
+                    multiples[(i - start) * num_rounds + round] = accumulator;
+                    for (size_t j = 0; round < num_rounds - 1 && j < window_bits; ++j) {
+                        accumulator.self_dbl();
+                    }
+                }
+            }
+            const size_t num_multiples = (end - start) * num_rounds;
+            Element::batch_normalize(&multiples[0], num_multiples);
+            for (size_t i = 0; i < num_multiples; ++i) {
+                table[start * num_rounds + i] = typename Curve::AffineElement(multiples[i].x, multiples[i].y);
+            }
+        }
+    });
+}
+
 /**
  * Compute the windowed-non-adjacent-form versions of our scalar multipliers.
  *
@@ -957,12 +1010,535 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+namespace {
+
+/**
+ * @brief Extract `num_bits` bits of a 128-bit endomorphism scalar, starting at bit `start`. Bits beyond the top of the
+ * scalar are treated as zero.
+ */
+inline uint64_t get_scalar_slice(const uint64_t* scalar, const size_t start, const size_t num_bits)
+{
+    if (start >= 128) {
+        return 0;
+    }
+    const size_t limb = start >> 6;
+    const size_t shift = start & 63;
+    uint64_t slice = scalar[limb] >> shift;
+    if (limb == 0 && shift + num_bits > 64) {
+        slice |= scalar[1] << (64 - shift);
+    }
+    return slice & ((1ULL << num_bits) - 1);
+}
+
+/**
+ * @brief Compute the signed (Booth-recoded) digit of window `round` of a 128-bit scalar.
+ *
+ * @details Digit i is d_i = w_i + b_{ic - 1} - 2^c * b_{ic + c - 1}, where w_i is the i-th c-bit window. Each digit
+ * lies in [-2^{c-1}, 2^{c-1}], so a window only needs 2^{c-1} buckets, and unlike the wnaf schedule used by
+ * `compute_wnaf_states`, every digit can be computed independently of the others. This is what allows
+ * `pippenger_batch_unsafe` to hand out (polynomial, round) pairs as independent units of work.
+ */
+inline int64_t get_signed_window_digit(const uint64_t* scalar, const size_t round, const size_t window_bits)
+{
+    const size_t start = round * window_bits;
+    const auto window = static_cast<int64_t>(get_scalar_slice(scalar, start, window_bits));
+    const auto carry_in = static_cast<int64_t>(start == 0 ? 0 : get_scalar_slice(scalar, start - 1, 1));
+    const int64_t carry_out = window >> (window_bits - 1);
+    return window + carry_in - (carry_out << window_bits);
+}
+
+/**
+ * @brief Bucket accumulator that keeps its buckets in affine form and adds points into them in batches, so that the
+ * cost of the field inversion is amortised across the batch (see `add_affine_points`).
+ *
+ * @details The additions within a batch must be independent of one another, so a point whose bucket is already part of
+ * the pending batch is instead added into a projective overflow bucket with a mixed addition. This is rare when the
+ * digits are spread over many buckets, and keeps the cost bounded when they are not (e.g. the top digits of a scalar).
+ */
+template <typename Curve> struct batch_affine_bucket_accumulator {
+    using Fq = typename Curve::BaseField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    static constexpr size_t MAX_BATCH_SIZE = 256;
+
+    std::vector<AffineElement> buckets;
+    std::vector<uint8_t> bucket_occupied;
+    std::vector<uint8_t> bucket_in_batch;
+    std::vector<Element> overflow_buckets;
+    std::vector<uint8_t> overflow_occupied;
+
+    std::vector<uint32_t> batch_buckets;
+    std::vector<AffineElement> batch_points;
+    std::vector<Fq> batch_scratch;
+    // with few buckets, large batches would mostly collide; keep the batch well below the number of buckets
+    size_t batch_size;
+
+    batch_affine_bucket_accumulator(const size_t num_buckets)
+        : buckets(num_buckets)
+        , bucket_occupied(num_buckets, 0)
+        , bucket_in_batch(num_buckets, 0)
+        , overflow_buckets(num_buckets)
+        , overflow_occupied(num_buckets, 0)
+        , batch_size(std::clamp<size_t>(num_buckets / 2, 1, MAX_BATCH_SIZE))
+    {
+        batch_buckets.reserve(batch_size);
+        batch_points.reserve(batch_size);
+        batch_scratch.resize(batch_size);
+    }
+
+    void add(const uint32_t bucket, const AffineElement& point)
+    {
+        if (bucket_occupied[bucket] == 0) {
+            buckets[bucket] = point;
+            bucket_occupied[bucket] = 1;
+            return;
+        }
+        // The affine addition formula is incomplete. Equal x-coordinates are (overwhelmingly unlikely to be) hit by
+        // sums of SRS points, but we route them to the complete formula rather than corrupting the bucket.
+        if (bucket_in_batch[bucket] != 0 || __builtin_expect(buckets[bucket].x == point.x, 0)) {
+            if (overflow_occupied[bucket] == 0) {
+                overflow_buckets[bucket] = Element(point);
+                overflow_occupied[bucket] = 1;
+            } else {
+                overflow_buckets[bucket] += point;
+            }
+            return;
+        }
+        bucket_in_batch[bucket] = 1;
+        batch_buckets.push_back(bucket);
+        batch_points.push_back(point);
+        if (batch_buckets.size() == batch_size) {
+            flush();
+        }
+    }
+
+    /**
+     * @brief Apply the pending batch of additions.
+     */
+    void finalize() { flush(); }
+
+    /**
+     * @brief Compute ∑ᵢ (i + 1)⋅bucket[i] with the usual running-sum trick.
+     */
+    Element reduce() const
+    {
+        Element running_sum;
+        running_sum.self_set_infinity();
+        Element accumulator;
+        accumulator.self_set_infinity();
+        for (size_t i = buckets.size() - 1; i < buckets.size(); --i) {
+            if (bucket_occupied[i] != 0) {
+                running_sum += buckets[i];
+            }
+            if (overflow_occupied[i] != 0) {
+                running_sum += overflow_buckets[i];
+            }
+            accumulator += running_sum;
+        }
+        return accumulator;
+    }
+
+  private:
+    void flush()
+    {
+        const size_t num_additions = batch_buckets.size();
+        if (num_additions == 0) {
+            return;
+        }
+        // Montgomery's batch inversion of the x-coordinate differences
+        Fq accumulator = Fq::one();
+        for (size_t i = 0; i < num_additions; ++i) {
+            batch_scratch[i] = accumulator;
+            accumulator *= (batch_points[i].x - buckets[batch_buckets[i]].x);
+        }
+        accumulator = accumulator.invert();
+        for (size_t i = num_additions - 1; i < num_additions; --i) {
+            AffineElement& bucket = buckets[batch_buckets[i]];
+            const AffineElement& point = batch_points[i];
+            const Fq x_diff = point.x - bucket.x;
+            const Fq lambda = (point.y - bucket.y) * (accumulator * batch_scratch[i]);
+            accumulator *= x_diff;
+            const Fq x3 = lambda.sqr() - bucket.x - point.x;
+            bucket.y = lambda * (bucket.x - x3) - bucket.y;
+            bucket.x = x3;
+            bucket_in_batch[batch_buckets[i]] = 0;
+        }
+        batch_buckets.clear();
+        batch_points.clear();
+    }
+};
+
+/**
+ * @brief Sum a set of affine points using batched affine additions (see `add_affine_points`).
+ *
+ * @details The points are summed pairwise in a binary tree; every level of the tree is a single batch of independent
+ * additions, so each addition costs a share of one inversion rather than a full mixed addition. The input is
+ * overwritten. Like `add_affine_points`, this assumes no two summands share an x-coordinate.
+ */
+template <typename Curve>
+typename Curve::Element sum_affine_points_unsafe(typename Curve::AffineElement* points, size_t num_points)
+{
+    using Element = typename Curve::Element;
+    std::vector<typename Curve::BaseField> scratch_space(num_points / 2);
+    Element result;
+    result.self_set_infinity();
+    while (num_points > 1) {
+        if ((num_points & 1) != 0) {
+            result += points[num_points - 1];
+            --num_points;
+        }
+        // the sums of the pairs are written to the upper half of the range
+        add_affine_points<Curve>(points, num_points, &scratch_space[0]);
+        points += num_points / 2;
+        num_points /= 2;
+    }
+    if (num_points == 1) {
+        result += points[0];
+    }
+    return result;
+}
+
+} // namespace
+
+/**
+ * @brief Compute one multi-scalar multiplication per scalar vector in `scalar_sets`, all against the same pippenger
+ * point table.
+ *
+ * @details `pippenger` parallelises within a single MSM: every call pays for its own wnaf computation, radix sort and
+ * bucket reduction, each of which is a separate fork-join over all threads (and `organize_buckets` can only use as
+ * many threads as there are rounds). When many polynomials are committed to back to back, this leaves cores idle at
+ * the end of every phase.
+ *
+ * Here the unit of work is instead a (scalar set, round, chunk of points) triple. The scalars are split with the curve
+ * endomorphism once, after which each round of each MSM is computed from Booth-recoded digits that can be extracted
+ * independently (see `get_signed_window_digit`). A task accumulates its chunk of points into a private set of affine
+ * buckets, using batched affine additions so that a point addition costs ~6 field multiplications, and reduces them
+ * to a single point. All tasks of all MSMs are scheduled in a single `parallel_for`, so the load is balanced across
+ * the whole batch rather than within each MSM.
+ *
+ * Like `pippenger_unsafe`, this assumes the points are linearly independent (e.g. an SRS).
+ *
+ * @param scalar_sets The scalar vectors, one per MSM. A vector of size n is multiplied against the first n points.
+ * @param points The pippenger point table (i.e. the output of `generate_pippenger_point_table`)
+ * @return std::vector<typename Curve::Element> The result of each MSM, in the order of `scalar_sets`
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(
+    std::span<std::span<const typename Curve::ScalarField>> scalar_sets, typename Curve::AffineElement* points)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+
+    // Below this many points per chunk, reducing the buckets starts to dominate the cost of filling them
+    constexpr size_t MIN_CHUNK_SIZE = 1 << 10;
+
+    struct msm_work {
+        size_t num_points;
+        size_t window_bits;
+        size_t num_rounds;
+        size_t num_chunks;
+        size_t chunk_size;
+        size_t first_task;
+        std::vector<Fr> split_scalars;
+    };
+
+    const size_t num_msms = scalar_sets.size();
+    const size_t num_threads = get_num_cpus();
+    // aim for a few tasks per thread so that uneven tasks still balance out
+    const size_t target_tasks_per_msm = (4 * num_threads + num_msms - 1) / std::max<size_t>(num_msms, 1);
+
+    std::vector<msm_work> work(num_msms);
+    size_t num_tasks = 0;
+    for (size_t i = 0; i < num_msms; ++i) {
+        msm_work& msm = work[i];
+        msm.num_points = scalar_sets[i].size();
+        msm.num_chunks = 1;
+        const auto configure = [&msm]() {
+            msm.chunk_size = (msm.num_points + msm.num_chunks - 1) / msm.num_chunks;
+            // same bucket count as `compute_wnaf_states`: 2^{c-1} buckets for c-bit signed digits
+            msm.window_bits = get_optimal_bucket_width(msm.chunk_size) + 1;
+            msm.num_rounds = get_num_signed_digit_rounds(msm.window_bits);
+        };
+        configure();
+        while (msm.num_rounds * msm.num_chunks < target_tasks_per_msm && msm.chunk_size >= 2 * MIN_CHUNK_SIZE) {
+            msm.num_chunks *= 2;
+            configure();
+        }
+        msm.first_task = num_tasks;
+        num_tasks += (msm.num_points == 0) ? 0 : msm.num_rounds * msm.num_chunks;
+
+        // Split each scalar k into (k1, k2) with k = k1 + λ⋅k2, stored in the low and high limbs respectively
+        msm.split_scalars.resize(msm.num_points);
+        run_loop_in_parallel(msm.num_points, [&](size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                Fr& k = msm.split_scalars[j];
+                k = scalar_sets[i][j].from_montgomery_form();
+                Fr::split_into_endomorphism_scalars(k, k, *(Fr*)&k.data[2]);
+            }
+        });
+    }
+
+    std::vector<Element> task_results(num_tasks);
+    parallel_for(num_tasks, [&](size_t task) {
+        // find the msm this task belongs to
+        size_t msm_index = num_msms - 1;
+        while (work[msm_index].num_points == 0 || work[msm_index].first_task > task) {
+            --msm_index;
+        }
+        const msm_work& msm = work[msm_index];
+        const size_t local_task = task - msm.first_task;
+        const size_t round = local_task / msm.num_chunks;
+        const size_t start = (local_task % msm.num_chunks) * msm.chunk_size;
+        const size_t end = std::min(start + msm.chunk_size, msm.num_points);
+
+        batch_affine_bucket_accumulator<Curve> accumulator(1ULL << (msm.window_bits - 1));
+        for (size_t j = start; j < end; ++j) {
+            const uint64_t* k = &msm.split_scalars[j].data[0];
+            for (size_t half = 0; half < 2; ++half) {
+                const int64_t digit = get_signed_window_digit(k + 2 * half, round, msm.window_bits);
+                if (digit == 0) {
+                    continue;
+                }
+                const auto& point = points[2 * j + half];
+                if (digit > 0) {
+                    accumulator.add(static_cast<uint32_t>(digit - 1), point);
+                } else {
+                    accumulator.add(static_cast<uint32_t>(-digit - 1), -point);
+                }
+            }
+        }
+        accumulator.finalize();
+        task_results[task] = accumulator.reduce();
+    });
+
+    // Combine the rounds of each msm, most significant round first
+    std::vector<Element> results(num_msms);
+    for (size_t i = 0; i < num_msms; ++i) {
+        const msm_work& msm = work[i];
+        Element& result = results[i];
+        result.self_set_infinity();
+        if (msm.num_points == 0) {
+            continue;
+        }
+        for (size_t round = msm.num_rounds - 1; round < msm.num_rounds; --round) {
+            for (size_t j = 0; j < msm.window_bits; ++j) {
+                result.self_dbl();
+            }
+            for (size_t chunk = 0; chunk < msm.num_chunks; ++chunk) {
+                result += task_results[msm.first_task + round * msm.num_chunks + chunk];
+            }
+        }
+    }
+    return results;
+}
+
+/**
+ * @brief Pippenger for scalar vectors that are mostly made up of zeros and ones, e.g. selectors or lookup counts.
+ *
+ * @details The scalars are first classified in one parallel pass. Zero scalars are dropped, the points of scalars
+ * equal to one are summed directly with batched affine additions (see `sum_affine_points_unsafe`), and only the
+ * remaining scalars (along with their endomorphism point pairs) are compacted and handed to `pippenger_unsafe`. If too
+ * few scalars are trivial to pay for the compaction, the input is passed to `pippenger_unsafe` unchanged, so this is
+ * never much slower than the dense algorithm.
+ *
+ * Like `pippenger_unsafe`, this assumes the points are linearly independent (e.g. an SRS).
+ *
+ * @param scalars The scalars, multiplied against the first scalars.size() points
+ * @param points The pippenger point table (i.e. the output of `generate_pippenger_point_table`)
+ * @param state Runtime state sized for at least scalars.size() points
+ */
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(std::span<const typename Curve::ScalarField> scalars,
+                                                typename Curve::AffineElement* points,
+                                                pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    // Take the sparse path if at least one in SPARSITY_THRESHOLD scalars is a zero or a one. Below that, the extra
+    // memory for the compacted copy of the inputs buys very little.
+    constexpr size_t SPARSITY_THRESHOLD = 4;
+
+    const size_t num_points = scalars.size();
+    const size_t num_threads = calculate_num_threads(num_points);
+    const size_t range_per_thread = num_points / num_threads;
+    const size_t leftovers = num_points - (range_per_thread * num_threads);
+    const auto thread_range = [&](size_t thread_idx) {
+        const size_t offset = thread_idx * range_per_thread;
+        const size_t end = (thread_idx == num_threads - 1) ? offset + range_per_thread + leftovers
+                                                           : offset + range_per_thread;
+        return std::make_pair(offset, end);
+    };
+
+    // Count the ones and the non-trivial scalars in each thread's range
+    std::vector<size_t> thread_num_ones(num_threads + 1, 0);
+    std::vector<size_t> thread_num_others(num_threads + 1, 0);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const auto [offset, end] = thread_range(thread_idx);
+        size_t num_ones = 0;
+        size_t num_others = 0;
+        for (size_t i = offset; i < end; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            if (scalars[i] == Fr::one()) {
+                ++num_ones;
+            } else {
+                ++num_others;
+            }
+        }
+        thread_num_ones[thread_idx + 1] = num_ones;
+        thread_num_others[thread_idx + 1] = num_others;
+    });
+    for (size_t i = 0; i < num_threads; ++i) {
+        thread_num_ones[i + 1] += thread_num_ones[i];
+        thread_num_others[i + 1] += thread_num_others[i];
+    }
+    const size_t num_ones = thread_num_ones[num_threads];
+    const size_t num_others = thread_num_others[num_threads];
+
+    if ((num_points - num_others) * SPARSITY_THRESHOLD < num_points) {
+        return pippenger_unsafe<Curve>(const_cast<Fr*>(scalars.data()), points, num_points, state);
+    }
+
+    // Compact the inputs. Each thread writes to the slots given by the prefix sums of the counts above.
+    std::vector<Fr> other_scalars(num_others);
+    std::vector<AffineElement> other_points(num_others * 2);
+    std::vector<AffineElement> one_points(num_ones);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const auto [offset, end] = thread_range(thread_idx);
+        size_t one_idx = thread_num_ones[thread_idx];
+        size_t other_idx = thread_num_others[thread_idx];
+        for (size_t i = offset; i < end; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            if (scalars[i] == Fr::one()) {
+                one_points[one_idx++] = points[i * 2];
+            } else {
+                other_scalars[other_idx] = scalars[i];
+                other_points[other_idx * 2] = points[i * 2];
+                other_points[other_idx * 2 + 1] = points[i * 2 + 1];
+                ++other_idx;
+            }
+        }
+    });
+
+    // Sum the points with unit scalars, one slice per thread
+    const size_t num_sum_threads = calculate_num_threads(num_ones);
+    const size_t ones_per_thread = (num_ones + num_sum_threads - 1) / num_sum_threads;
+    std::vector<Element> partial_sums(num_sum_threads);
+    parallel_for(num_sum_threads, [&](size_t thread_idx) {
+        const size_t offset = std::min(thread_idx * ones_per_thread, num_ones);
+        const size_t end = std::min(offset + ones_per_thread, num_ones);
+        partial_sums[thread_idx] = sum_affine_points_unsafe<Curve>(one_points.data() + offset, end - offset);
+    });
+
+    Element result = pippenger_unsafe<Curve>(other_scalars.data(), other_points.data(), num_others, state);
+    for (const Element& partial_sum : partial_sums) {
+        result += partial_sum;
+    }
+    return result;
+}
+
+/**
+ * @brief Multi-scalar multiplication against a fixed-base table (see `generate_fixed_base_table`).
+ *
+ * @details With the multiples 2^{r⋅c}⋅Pᵢ precomputed, ∑ᵢ kᵢ⋅Pᵢ = ∑ᵢ ∑ᵣ dᵢᵣ⋅(2^{r⋅c}⋅Pᵢ), where dᵢᵣ are the signed c-bit
+ * digits of the endomorphism halves of kᵢ. All digits of all scalars can therefore be added into a single set of
+ * 2^{c-1} buckets: there is one bucket reduction per thread rather than one per round, and no doublings between
+ * rounds. This makes wider windows worthwhile than in `pippenger`, at the cost of a table that is
+ * `get_num_signed_digit_rounds(c)` times the size of the SRS. Zero digits are skipped, so sparse scalars are cheap too.
+ *
+ * Like `pippenger_unsafe`, this assumes the points are linearly independent (e.g. an SRS).
+ *
+ * @param scalars The scalars, multiplied against the first scalars.size() points of the table
+ * @param table The output of `generate_fixed_base_table`
+ * @param window_bits The window size the table was generated with
+ */
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_unsafe(std::span<const typename Curve::ScalarField> scalars,
+                                                    const typename Curve::AffineElement* table,
+                                                    const size_t window_bits)
+{
+    BB_OP_COUNT_TIME();
+    using Fr = typename Curve::ScalarField;
+    using Fq = typename Curve::BaseField;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t num_points = scalars.size();
+    const size_t num_rounds = get_num_signed_digit_rounds(window_bits);
+    const size_t num_buckets = 1ULL << (window_bits - 1);
+    const Fq beta = Fq::cube_root_of_unity();
+
+    // Each scalar costs up to 2 * num_rounds bucket additions and each thread reduces its own buckets at a cost of
+    // 2 * num_buckets additions; make sure the former dominates
+    const size_t min_points_per_thread = std::max<size_t>(num_buckets / num_rounds, DEFAULT_MIN_ITERS_PER_THREAD);
+    const size_t num_threads = calculate_num_threads(num_points, min_points_per_thread);
+    const size_t range_per_thread = num_points / num_threads;
+    const size_t leftovers = num_points - (range_per_thread * num_threads);
+
+    std::vector<Element> thread_results(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t offset = thread_idx * range_per_thread;
+        const size_t end = (thread_idx == num_threads - 1) ? offset + range_per_thread + leftovers
+                                                           : offset + range_per_thread;
+        batch_affine_bucket_accumulator<Curve> accumulator(num_buckets);
+        for (size_t i = offset; i < end; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            Fr k = scalars[i].from_montgomery_form();
+            Fr::split_into_endomorphism_scalars(k, k, *(Fr*)&k.data[2]);
+            const AffineElement* multiples = table + i * num_rounds;
+            for (size_t round = 0; round < num_rounds; ++round) {
+                for (size_t half = 0; half < 2; ++half) {
+                    const int64_t digit = get_signed_window_digit(&k.data[2 * half], round, window_bits);
+                    if (digit == 0) {
+                        continue;
+                    }
+                    // the second half multiplies the endomorphism point (β⋅x, -y)
+                    AffineElement point = multiples[round];
+                    if (half == 1) {
+                        point.x *= beta;
+                        point.y = -point.y;
+                    }
+                    if (digit > 0) {
+                        accumulator.add(static_cast<uint32_t>(digit - 1), point);
+                    } else {
+                        accumulator.add(static_cast<uint32_t>(-digit - 1), -point);
+                    }
+                }
+            }
+        }
+        accumulator.finalize();
+        thread_results[thread_idx] = accumulator.reduce();
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (const Element& thread_result : thread_results) {
+        result += thread_result;
+    }
+    return result;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
                                                            curve::BN254::AffineElement* table,
                                                            size_t num_points);
 
+template void generate_fixed_base_table<curve::BN254>(const curve::BN254::AffineElement* points,
+                                                      curve::BN254::AffineElement* table,
+                                                      const size_t num_points,
+                                                      const size_t window_bits);
+
 template uint32_t construct_addition_chains<curve::BN254>(affine_product_runtime_state<curve::BN254>& state,
                                                           bool empty_bucket_counts = true);
 
@@ -1003,6 +1579,19 @@ template curve::BN254::Element pippenger_unsafe<curve::BN254>(curve::BN254::Scal
                                                               const size_t num_initial_points,
                                                               pippenger_runtime_state<curve::BN254>& state);
 
+template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<std::span<const curve::BN254::ScalarField>> scalar_sets, curve::BN254::AffineElement* points);
+
+template curve::BN254::Element pippenger_sparse_unsafe<curve::BN254>(
+    std::span<const curve::BN254::ScalarField> scalars,
+    curve::BN254::AffineElement* points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+template curve::BN254::Element pippenger_fixed_base_unsafe<curve::BN254>(
+    std::span<const curve::BN254::ScalarField> scalars,
+    const curve::BN254::AffineElement* table,
+    const size_t window_bits);
+
 template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve::BN254>(
     curve::BN254::ScalarField* scalars,
     curve::BN254::AffineElement* points,
@@ -1014,6 +1603,11 @@ template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::A
                                                               curve::Grumpkin::AffineElement* table,
                                                               size_t num_points);
 
+template void generate_fixed_base_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
+                                                         curve::Grumpkin::AffineElement* table,
+                                                         const size_t num_points,
+                                                         const size_t window_bits);
+
 template uint32_t construct_addition_chains<curve::Grumpkin>(affine_product_runtime_state<curve::Grumpkin>& state,
                                                              bool empty_bucket_counts = true);
 
@@ -1054,6 +1648,19 @@ template curve::Grumpkin::Element pippenger_unsafe<curve::Grumpkin>(curve::Grump
                                                                     const size_t num_initial_points,
                                                                     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<std::span<const curve::Grumpkin::ScalarField>> scalar_sets, curve::Grumpkin::AffineElement* points);
+
+template curve::Grumpkin::Element pippenger_sparse_unsafe<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars,
+    curve::Grumpkin::AffineElement* points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template curve::Grumpkin::Element pippenger_fixed_base_unsafe<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars,
+    const curve::Grumpkin::AffineElement* table,
+    const size_t window_bits);
+
 template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<curve::Grumpkin>(
     curve::Grumpkin::ScalarField* scalars,
     curve::Grumpkin::AffineElement* points,
@@ -5,6 +5,8 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -14,6 +16,15 @@ constexpr size_t get_num_buckets(const size_t num_points)
     return 1UL << bits_per_bucket;
 }
 
+/**
+ * @brief The number of signed `window_bits`-bit digits needed to represent a 128-bit endomorphism scalar. The top digit
+ * must absorb the carry out of bit 127.
+ */
+constexpr size_t get_num_signed_digit_rounds(const size_t window_bits)
+{
+    return (128 + window_bits) / window_bits;
+}
+
 /**
  * pointers that describe how to add points into buckets, for the pippenger algorithm.
  * `wnaf_table` is an unrolled two-dimensional array, with each inner array being of size `n`,
@@ -97,6 +108,12 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
                                     typename Curve::AffineElement* table,
                                     size_t num_points);
 
+template <typename Curve>
+void generate_fixed_base_table(const typename Curve::AffineElement* points,
+                               typename Curve::AffineElement* table,
+                               size_t num_points,
+                               size_t window_bits);
+
 void organize_buckets(uint64_t* point_schedule, size_t num_points);
 
 inline void count_bits(const uint32_t* bucket_counts,
@@ -164,6 +181,20 @@ typename Curve::Element pippenger_unsafe(typename Curve::ScalarField* scalars,
                                          size_t num_initial_points,
                                          pippenger_runtime_state<Curve>& state);
 
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(
+    std::span<std::span<const typename Curve::ScalarField>> scalar_sets, typename Curve::AffineElement* points);
+
+template <typename Curve>
+typename Curve::Element pippenger_sparse_unsafe(std::span<const typename Curve::ScalarField> scalars,
+                                                typename Curve::AffineElement* points,
+                                                pippenger_runtime_state<Curve>& state);
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_unsafe(std::span<const typename Curve::ScalarField> scalars,
+                                                    const typename Curve::AffineElement* table,
+                                                    size_t window_bits);
+
 template <typename Curve>
 typename Curve::Element pippenger_without_endomorphism_basis_points(typename Curve::ScalarField* scalars,
                                                                     typename Curve::AffineElement* points,
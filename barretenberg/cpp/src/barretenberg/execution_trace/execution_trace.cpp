@@ -38,6 +38,7 @@ void ExecutionTrace_<Flavor>::add_wires_and_selectors_to_proving_key(TraceData&
             pkey_selector = trace_selector.share();
         }
         proving_key.pub_inputs_offset = trace_data.pub_inputs_offset;
+        proving_key.active_trace_end = trace_data.active_trace_end;
     } else if constexpr (IsPlonkFlavor<Flavor>) {
         for (size_t idx = 0; idx < trace_data.wires.size(); ++idx) {
             std::string wire_tag = "w_" + std::to_string(idx + 1) + "_lagrange";
@@ -115,6 +116,8 @@ typename ExecutionTrace_<Flavor>::TraceData ExecutionTrace_<Flavor>::construct_t
 
         offset += block_size;
     }
+    // The blocks are placed contiguously, so no row past the last one holds a gate
+    trace_data.active_trace_end = offset;
     return trace_data;
 }
 
@@ -23,6 +23,7 @@ template <class Flavor> class ExecutionTrace_ {
         std::vector<CyclicPermutation> copy_cycles;
         uint32_t ram_rom_offset = 0;    // offset of the RAM/ROM block in the execution trace
         uint32_t pub_inputs_offset = 0; // offset of the public inputs block in the execution trace
+        uint32_t active_trace_end = 0;  // end of the last block in the execution trace
 
         TraceData(size_t dyadic_circuit_size, Builder& builder)
         {
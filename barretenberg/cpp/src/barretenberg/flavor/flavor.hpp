@@ -115,6 +115,10 @@ class ProvingKey_ : public PrecomputedPolynomials, public WitnessPolynomials {
     // instances
     size_t pub_inputs_offset = 0;
 
+    // end of the rows of the execution trace holding gates: every gate selector vanishes on the rows past it. Zero if
+    // unknown, e.g. for keys not constructed from a circuit, in which case any row may hold a gate.
+    size_t active_trace_end = 0;
+
     // The number of public inputs has to be the same for all instances because they are
     // folded element by element.
     std::vector<FF> public_inputs;
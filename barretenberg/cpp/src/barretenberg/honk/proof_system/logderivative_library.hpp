@@ -1,8 +1,34 @@
 #pragma once
+#include "barretenberg/common/constexpr_utils.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/zip_view.hpp"
+#include <tuple>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 
 namespace bb {
 
+/**
+ * @brief Copy the values at row i of the polynomials into row
+ * @details If the relation lists the entities it reads to compute the inverse (get_inverse_entities), only those are
+ * copied and the rest of the row is left as is. Otherwise the whole row is copied, as get_row would.
+ */
+template <typename Relation, typename AllValues, typename Polynomials>
+void get_inverse_row(AllValues& row, const Polynomials& polynomials, const size_t i)
+{
+    if constexpr (requires { Relation::get_inverse_entities(row); }) {
+        auto row_entities = Relation::get_inverse_entities(row);
+        const auto polynomial_entities = Relation::get_inverse_entities(polynomials);
+        bb::constexpr_for<0, std::tuple_size_v<decltype(row_entities)>, 1>(
+            [&]<size_t k>() { std::get<k>(row_entities) = std::get<k>(polynomial_entities)[i]; });
+    } else {
+        for (auto [value, polynomial] : zip_view(row.get_all(), polynomials.get_all())) {
+            value = polynomial[i];
+        }
+    }
+}
+
 /**
  * @brief Compute the inverse polynomial I(X) required for logderivative lookups
  * *
@@ -21,11 +47,16 @@ namespace bb {
  *
  * The specific algebraic relations that define read terms and write terms are defined in Flavor::LookupRelation
  *
+ * The rows are split into chunks that are processed in parallel. Each thread gathers only the entities the relation
+ * reads (see get_inverse_row), computes the denominators of the rows where the relation is active into a compact
+ * buffer, batch-inverts that buffer and scatters the inverses back. Inactive rows are set to zero.
+ *
  */
 template <typename Flavor, typename Relation, typename Polynomials>
 void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_parameters, const size_t circuit_size)
 {
     using FF = typename Flavor::FF;
+    using AllValues = typename Flavor::AllValues;
     using Accumulator = typename Relation::ValueAccumulator0;
     constexpr size_t READ_TERMS = Relation::READ_TERMS;
     constexpr size_t WRITE_TERMS = Relation::WRITE_TERMS;
@@ -33,28 +64,43 @@ void compute_logderivative_inverse(Polynomials& polynomials, auto& relation_para
     auto lookup_relation = Relation();
 
     auto& inverse_polynomial = lookup_relation.template get_inverse_polynomial(polynomials);
-    for (size_t i = 0; i < circuit_size; ++i) {
-        auto row = polynomials.get_row(i);
-        bool has_inverse = lookup_relation.operation_exists_at_row(row);
-        if (!has_inverse) {
-            continue;
-        }
-        FF denominator = 1;
-        bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
-            auto denominator_term =
-                lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
-            auto denominator_term =
-                lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
-            denominator *= denominator_term;
-        });
-        inverse_polynomial[i] = denominator;
-    };
-
-    // todo might be inverting zero in field bleh bleh
-    FF::batch_invert(inverse_polynomial);
+    const auto& input_polynomials = std::as_const(polynomials);
+    // Small traces are not worth splitting, each chunk should be large enough to amortise its inversion
+    constexpr size_t MIN_ROWS_FOR_MULTITHREADING = 1 << 10;
+    run_loop_in_parallel(
+        circuit_size,
+        [&](size_t start, size_t end) {
+            AllValues row;
+            std::vector<FF> denominators;
+            std::vector<size_t> active_rows;
+            for (size_t i = start; i < end; ++i) {
+                get_inverse_row<Relation>(row, input_polynomials, i);
+                if (!lookup_relation.operation_exists_at_row(row)) {
+                    inverse_polynomial[i] = 0;
+                    continue;
+                }
+                FF denominator = 1;
+                bb::constexpr_for<0, READ_TERMS, 1>([&]<size_t read_index> {
+                    auto denominator_term =
+                        lookup_relation.template compute_read_term<Accumulator, read_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                bb::constexpr_for<0, WRITE_TERMS, 1>([&]<size_t write_index> {
+                    auto denominator_term =
+                        lookup_relation.template compute_write_term<Accumulator, write_index>(row, relation_parameters);
+                    denominator *= denominator_term;
+                });
+                denominators.emplace_back(denominator);
+                active_rows.emplace_back(i);
+            }
+
+            // todo might be inverting zero in field bleh bleh
+            FF::batch_invert(denominators);
+            for (size_t k = 0; k < active_rows.size(); ++k) {
+                inverse_polynomial[active_rows[k]] = denominators[k];
+            }
+        },
+        MIN_ROWS_FOR_MULTITHREADING);
 }
 
 /**
@@ -14,7 +14,8 @@
 #include "barretenberg/polynomials/polynomial_store_cache.hpp"
 // #include "barretenberg/polynomials/polynomial_store_wasm.hpp"
 #else
-#include "barretenberg/polynomials/polynomial_store.hpp"
+// Heap-backed unless BB_POLYNOMIAL_STORE_DIR is set, see PolynomialStoreMmap
+#include "barretenberg/polynomials/polynomial_store_mmap.hpp"
 #endif
 
 namespace bb::plonk {
@@ -31,7 +32,7 @@ struct proving_key_data {
     PolynomialStoreCache polynomial_store;
     // PolynomialStoreWasm<bb::fr> polynomial_store;
 #else
-    PolynomialStore<bb::fr> polynomial_store;
+    PolynomialStoreMmap<bb::fr> polynomial_store;
 #endif
 };
 
@@ -67,7 +68,7 @@ struct proving_key {
     PolynomialStoreCache polynomial_store;
     // PolynomialStoreWasm<bb::fr> polynomial_store;
 #else
-    PolynomialStore<bb::fr> polynomial_store;
+    PolynomialStoreMmap<bb::fr> polynomial_store;
 #endif
 
     bb::evaluation_domain small_domain;
@@ -73,7 +73,7 @@ void compute_grand_product(const size_t circuit_size,
         auto evaluations_view = evaluations.get_all();
         for (size_t i = start; i < end; ++i) {
             for (auto [eval, full_poly] : zip_view(evaluations_view, full_polynomials_view)) {
-                eval = full_poly.size() > i ? full_poly[i] : 0;
+                eval = full_poly.get(i);
             }
             numerator[i] = GrandProdRelation::template compute_grand_product_numerator<Accumulator>(
                 evaluations, relation_parameters);
@@ -16,17 +16,19 @@
 namespace bb {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
-template <typename Fr> std::shared_ptr<Fr[]> _allocate_aligned_memory(const size_t n_elements)
+template <typename Fr>
+std::shared_ptr<Fr[]> _allocate_aligned_memory(const size_t n_elements,
+                                               std::source_location location = std::source_location::current())
 {
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
-    return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements));
+    return std::static_pointer_cast<Fr[]>(get_mem_slab(sizeof(Fr) * n_elements, location));
 }
 
-template <typename Fr> void Polynomial<Fr>::allocate_backing_memory(size_t n_elements)
+template <typename Fr> void Polynomial<Fr>::allocate_backing_memory(size_t n_elements, std::source_location location)
 {
     size_ = n_elements;
     // capacity() is size_ plus padding for shifted polynomials
-    backing_memory_ = _allocate_aligned_memory<Fr>(capacity());
+    backing_memory_ = _allocate_aligned_memory<Fr>(capacity(), location);
     coefficients_ = backing_memory_.get();
 }
 
@@ -39,9 +41,9 @@ template <typename Fr> void Polynomial<Fr>::allocate_backing_memory(size_t n_ele
  *
  * @param initial_size The initial size of the polynomial.
  */
-template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size)
+template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size, std::source_location location)
 {
-    allocate_backing_memory(initial_size);
+    allocate_backing_memory(initial_size, location);
     memset(static_cast<void*>(coefficients_), 0, sizeof(Fr) * capacity());
 }
 
@@ -52,25 +54,52 @@ template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size)
  * @param initial_size The initial size of the polynomial.
  * @param flag Signals that we do not zero memory.
  */
-template <typename Fr> Polynomial<Fr>::Polynomial(size_t initial_size, DontZeroMemory flag)
+template <typename Fr>
+Polynomial<Fr>::Polynomial(size_t initial_size, DontZeroMemory flag, std::source_location location)
 {
     // Flag is unused, but we don't memset 0 if passed.
     (void)flag;
-    allocate_backing_memory(initial_size);
+    allocate_backing_memory(initial_size, location);
 }
 
+/**
+ * @brief Initialize a structured Polynomial, zeroing the stored coefficients.
+ *
+ * @param size The number of stored coefficients.
+ * @param virtual_size The length of the polynomial.
+ * @param start_index The index of the first stored coefficient.
+ */
 template <typename Fr>
-Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
-    : Polynomial<Fr>(other, other.size())
-{}
+Polynomial<Fr>::Polynomial(size_t size, size_t virtual_size, size_t start_index, std::source_location location)
+{
+    ASSERT(start_index + size <= virtual_size);
+    allocate_backing_memory(size, location);
+    memset(static_cast<void*>(coefficients_), 0, sizeof(Fr) * capacity());
+    start_index_ = start_index;
+    virtual_padding_ = virtual_size - start_index - size;
+}
 
-// fully copying "expensive" constructor
-template <typename Fr> Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other, const size_t target_size)
+// fully copying "expensive" constructor, which keeps the structure of other
+template <typename Fr> Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other)
 {
-    allocate_backing_memory(std::max(target_size, other.size()));
+    allocate_backing_memory(other.size_);
 
     memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * other.size_);
     zero_memory_beyond(other.size_);
+    start_index_ = other.start_index_;
+    virtual_padding_ = other.virtual_padding_;
+}
+
+// fully copying "expensive" constructor, storing all coefficients from index 0 up to at least target_size
+template <typename Fr> Polynomial<Fr>::Polynomial(const Polynomial<Fr>& other, const size_t target_size)
+{
+    allocate_backing_memory(std::max(target_size, other.end_index()));
+
+    memset(static_cast<void*>(coefficients_), 0, sizeof(Fr) * other.start_index_);
+    memcpy(static_cast<void*>(coefficients_ + other.start_index_),
+           static_cast<void*>(other.coefficients_),
+           sizeof(Fr) * other.size_);
+    zero_memory_beyond(other.end_index());
 }
 
 // move constructor
@@ -79,6 +108,8 @@ Polynomial<Fr>::Polynomial(Polynomial<Fr>&& other) noexcept
     : backing_memory_(std::exchange(other.backing_memory_, nullptr))
     , coefficients_(std::exchange(other.coefficients_, nullptr))
     , size_(std::exchange(other.size_, 0))
+    , virtual_padding_(std::exchange(other.virtual_padding_, 0))
+    , start_index_(std::exchange(other.start_index_, 0))
 {}
 
 // span constructor
@@ -91,6 +122,15 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     zero_memory_beyond(size_);
 }
 
+// wrapping constructor
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size)
+    : backing_memory_(std::move(backing_memory))
+    , coefficients_(backing_memory_.get())
+    , size_(size)
+{}
+
 // interpolation constructor
 template <typename Fr>
 Polynomial<Fr>::Polynomial(std::span<const Fr> interpolation_points, std::span<const Fr> evaluations)
@@ -113,6 +153,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(const Polynomia
     allocate_backing_memory(other.size_);
     memcpy(static_cast<void*>(coefficients_), static_cast<void*>(other.coefficients_), sizeof(Fr) * other.size_);
     zero_memory_beyond(size_);
+    virtual_padding_ = other.virtual_padding_;
+    start_index_ = other.start_index_;
     return *this;
 }
 
@@ -134,6 +176,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator=(Polynomial&& ot
     backing_memory_ = std::exchange(other.backing_memory_, nullptr);
     coefficients_ = std::exchange(other.coefficients_, nullptr);
     size_ = std::exchange(other.size_, 0);
+    virtual_padding_ = std::exchange(other.virtual_padding_, 0);
+    start_index_ = std::exchange(other.start_index_, 0);
     return *this;
 }
 
@@ -143,17 +187,53 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::share() const
     p.backing_memory_ = backing_memory_;
     p.size_ = size_;
     p.coefficients_ = coefficients_;
+    p.virtual_padding_ = virtual_padding_;
+    p.start_index_ = start_index_;
+    return p;
+}
+
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::view(const size_t offset, const size_t size) const
+{
+    ASSERT(offset >= start_index_ && offset + size <= end_index());
+    Polynomial p;
+    p.backing_memory_ = backing_memory_;
+    p.size_ = size;
+    p.coefficients_ = coefficients_ + (offset - start_index_);
+    p.start_index_ = offset;
+    return p;
+}
+
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::extended_to(const size_t virtual_size) const
+{
+    ASSERT(virtual_size >= end_index());
+    Polynomial p = share();
+    p.virtual_padding_ = virtual_size - end_index();
+    return p;
+}
+
+template <typename Fr> Polynomial<Fr> Polynomial<Fr>::stored_range(const size_t start, const size_t size)
+{
+    ASSERT(start >= start_index_ && start + size <= end_index());
+    Polynomial p;
+    p.backing_memory_ = backing_memory_;
+    p.size_ = size;
+    p.coefficients_ = coefficients_ + (start - start_index_);
     return p;
 }
 
 template <typename Fr> Fr Polynomial<Fr>::evaluate(const Fr& z, const size_t target_size) const
 {
-    return polynomial_arithmetic::evaluate(coefficients_, z, target_size);
+    if (start_index_ == 0) {
+        return polynomial_arithmetic::evaluate(coefficients_, z, target_size);
+    }
+    // z^start * ∑ᵢ aᵢ₊ₛₜₐᵣₜ⋅zⁱ
+    ASSERT(target_size >= start_index_);
+    return polynomial_arithmetic::evaluate(coefficients_, z, target_size - start_index_) * z.pow(start_index_);
 }
 
 template <typename Fr> Fr Polynomial<Fr>::evaluate(const Fr& z) const
 {
-    return polynomial_arithmetic::evaluate(coefficients_, z, size_);
+    return evaluate(z, end_index());
 }
 
 template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) const
@@ -162,13 +242,15 @@ template <typename Fr> bool Polynomial<Fr>::operator==(Polynomial const& rhs) co
     if (is_empty() || rhs.is_empty()) {
         return is_empty() && rhs.is_empty();
     }
-    // Size must agree
-    if (size() != rhs.size()) {
+    // Size must agree, counting virtual zeros
+    if (virtual_size() != rhs.virtual_size()) {
         return false;
     }
-    // Each coefficient must agree
-    for (size_t i = 0; i < size(); i++) {
-        if (coefficients_[i] != rhs.coefficients_[i]) {
+    // Each coefficient must agree, where a coefficient that is not stored is zero
+    const size_t start = std::min(start_index(), rhs.start_index());
+    const size_t end = std::max(end_index(), rhs.end_index());
+    for (size_t i = start; i < end; i++) {
+        if (get(i) != rhs.get(i)) {
             return false;
         }
     }
@@ -321,6 +403,13 @@ Fr Polynomial<Fr>::evaluate_from_fft(const EvaluationDomain<Fr>& large_domain,
 
 template <typename Fr> Polynomial<Fr> Polynomial<Fr>::shifted() const
 {
+    if (start_index_ > 0) {
+        // The shift of a structured polynomial only moves its stored range down by one
+        Polynomial p = share();
+        p.start_index_ = start_index_ - 1;
+        p.virtual_padding_ = virtual_padding_ + 1;
+        return p;
+    }
     ASSERT(size_ > 0);
     ASSERT(coefficients_[0].is_zero());
     ASSERT(coefficients_[size_].is_zero()); // relies on MAXIMUM_COEFFICIENT_SHIFT >= 1
@@ -328,6 +417,7 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::shifted() const
     p.backing_memory_ = backing_memory_;
     p.size_ = size_;
     p.coefficients_ = coefficients_ + 1;
+    p.virtual_padding_ = virtual_padding_;
     return p;
 }
 
@@ -418,6 +508,23 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(std::span<cons
     return *this;
 }
 
+template <typename Fr> void Polynomial<Fr>::add_scaled(const Polynomial& other, Fr scaling_factor)
+{
+    stored_range(other.start_index_, other.size_).add_scaled(std::span<const Fr>(other), scaling_factor);
+}
+
+template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(const Polynomial& other)
+{
+    stored_range(other.start_index_, other.size_) += std::span<const Fr>(other);
+    return *this;
+}
+
+template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(const Polynomial& other)
+{
+    stored_range(other.start_index_, other.size_) -= std::span<const Fr>(other);
+    return *this;
+}
+
 template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scaling_factor)
 {
     ASSERT(in_place_operation_viable());
@@ -440,41 +547,48 @@ template <typename Fr> Fr Polynomial<Fr>::evaluate_mle(std::span<const Fr> evalu
 {
     const size_t m = evaluation_points.size();
 
-    // To simplify handling of edge cases, we assume that size_ is always a power of 2
-    ASSERT(size_ == static_cast<size_t>(1 << m));
-
-    // we do m rounds l = 0,...,m-1.
-    // in round l, n_l is the size of the buffer containing the polynomial partially evaluated
-    // at u₀,..., u_l.
-    // in round 0, this is half the size of n
-    size_t n_l = 1 << (m - 1);
+    // To simplify handling of edge cases, we assume that the virtual size is always a power of 2
+    ASSERT(virtual_size() == static_cast<size_t>(1 << m));
 
-    // temporary buffer of half the size of the polynomial
-    // TODO(AD): Make this a polynomial with DontZeroMemory::FLAG
-    pointer tmp_ptr = _allocate_aligned_memory<Fr>(sizeof(Fr) * n_l);
-    auto tmp = tmp_ptr.get();
+    // we do m rounds l = 0,...,m-1. in round l, the buffer holds the polynomial partially evaluated at u₀,..., u_l,
+    // so a temporary buffer of half the size of the polynomial suffices.
+    Polynomial tmp(static_cast<size_t>(1) << (m - 1), DontZeroMemory::FLAG);
 
-    Fr* prev = coefficients_;
+    // The entries that can be nonzero are [lo, hi), stored from prev[0]. With a shift, entry j is coefficient j + 1,
+    // and the shift of a polynomial stored from index 0 drops its first (zero) coefficient.
+    const Fr* prev = coefficients_;
+    size_t lo = start_index_;
+    size_t hi = end_index();
     if (shift) {
-        ASSERT(prev[0] == Fr::zero());
-        prev++;
+        if (start_index_ == 0) {
+            ASSERT(size_ > 0);
+            ASSERT(prev[0] == Fr::zero());
+            prev++;
+        } else {
+            lo--;
+        }
+        hi--;
     }
 
-    Fr u_l = evaluation_points[0];
-    for (size_t i = 0; i < n_l; ++i) {
-        // curr[i] = (Fr(1) - u_l) * prev[i << 1] + u_l * prev[(i << 1) + 1];
-        tmp[i] = prev[i << 1] + u_l * (prev[(i << 1) + 1] - prev[i << 1]);
-    }
+    // Fold pairs of entries of `in`, whose first element is entry `offset`, into `out`. The entries outside of [lo, hi)
+    // are zero, and only the entries in the halved range that can be nonzero are written.
+    const auto fold = [&lo, &hi](const Fr* in, size_t offset, Fr* out, const Fr& u_l) {
+        const auto entry = [&](size_t j) { return j >= lo && j < hi ? in[j - offset] : Fr::zero(); };
+        for (size_t i = lo >> 1; i < (hi + 1) >> 1; ++i) {
+            // curr[i] = (Fr(1) - u_l) * prev[i << 1] + u_l * prev[(i << 1) + 1];
+            const Fr low = entry(i << 1);
+            out[i] = low + u_l * (entry((i << 1) + 1) - low);
+        }
+        lo >>= 1;
+        hi = (hi + 1) >> 1;
+    };
+
+    fold(prev, lo, tmp.begin(), evaluation_points[0]);
     // partially evaluate the m-1 remaining points
     for (size_t l = 1; l < m; ++l) {
-        n_l = 1 << (m - l - 1);
-        u_l = evaluation_points[l];
-        for (size_t i = 0; i < n_l; ++i) {
-            tmp[i] = tmp[i << 1] + u_l * (tmp[(i << 1) + 1] - tmp[i << 1]);
-        }
+        fold(tmp.begin(), 0, tmp.begin(), evaluation_points[l]);
     }
-    Fr result = tmp[0];
-    return result;
+    return lo < hi ? tmp[0] : Fr::zero();
 }
 
 template <typename Fr> Polynomial<Fr> Polynomial<Fr>::partial_evaluate_mle(std::span<const Fr> evaluation_points) const
@@ -483,9 +597,9 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::partial_evaluate_mle(std::
     const size_t m = evaluation_points.size();
 
     // Assert that the size of the polynomial being evaluated is a power of 2 greater than (1 << m)
-    ASSERT(numeric::is_power_of_two(size_));
-    ASSERT(size_ >= static_cast<size_t>(1 << m));
-    size_t n = numeric::get_msb(size_);
+    ASSERT(numeric::is_power_of_two(virtual_size()));
+    ASSERT(virtual_size() >= static_cast<size_t>(1 << m));
+    size_t n = numeric::get_msb(virtual_size());
 
     // Partial evaluation is done in m rounds l = 0,...,m-1. At the end of round l, the polynomial has been partially
     // evaluated at u_{m-l-1}, ..., u_{m-1} in variables X_{n-l-1}, ..., X_{n-1}. The size of this polynomial is n_l.
@@ -498,8 +612,9 @@ template <typename Fr> Polynomial<Fr> Polynomial<Fr>::partial_evaluate_mle(std::
     Fr u_l = evaluation_points[m - 1];
 
     for (size_t i = 0; i < n_l; i++) {
-        // Initiate our intermediate results using this polynomial.
-        intermediate[i] = at(i) + u_l * (at(i + n_l) - at(i));
+        // Initiate our intermediate results using this polynomial, whose coefficients that are not stored are zero.
+        const Fr low = get(i);
+        intermediate[i] = low + u_l * (get(i + n_l) - low);
     }
     // Evaluate m-1 variables X_{n-l-1}, ..., X_{n-2} at m-1 remaining values u_0,...,u_{m-2})
     for (size_t l = 1; l < m; ++l) {
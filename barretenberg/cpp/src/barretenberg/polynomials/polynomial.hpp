@@ -5,6 +5,7 @@
 #include "evaluation_domain.hpp"
 #include "polynomial_arithmetic.hpp"
 #include <fstream>
+#include <source_location>
 
 namespace bb {
 enum class DontZeroMemory { FLAG };
@@ -24,9 +25,20 @@ template <typename Fr> class Polynomial {
     using const_iterator = Fr const*;
     using FF = Fr;
 
-    Polynomial(size_t initial_size);
+    // The location of the constructing call is recorded by the current SlabArena, if any
+    Polynomial(size_t initial_size, std::source_location location = std::source_location::current());
     // Constructor that does not initialize values, use with caution to save time.
-    Polynomial(size_t initial_size, DontZeroMemory flag);
+    Polynomial(size_t initial_size,
+               DontZeroMemory flag,
+               std::source_location location = std::source_location::current());
+    /**
+     * @brief A structured polynomial of length `virtual_size` that is zero outside of the `size` coefficients starting at
+     * `start_index`. Only those are stored, zeroed.
+     */
+    Polynomial(size_t size,
+               size_t virtual_size,
+               size_t start_index,
+               std::source_location location = std::source_location::current());
     Polynomial(const Polynomial& other);
     Polynomial(const Polynomial& other, size_t target_size);
 
@@ -35,6 +47,13 @@ template <typename Fr> class Polynomial {
     // Create a polynomial from the given fields.
     Polynomial(std::span<const Fr> coefficients);
 
+    /**
+     * @brief Wrap existing memory of at least size + MAXIMUM_COEFFICIENT_SHIFT elements (e.g. a file mapping). The
+     * memory is neither copied nor zeroed, and is released by its deleter once no polynomial shares it.
+     */
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size);
+
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
@@ -58,6 +77,20 @@ template <typename Fr> class Polynomial {
      */
     Polynomial share() const;
 
+    /**
+     * @brief A view of the `size` coefficients starting at index `offset`, sharing memory with this polynomial and
+     * keeping its indices, i.e. the view is structured with start_index() == offset. The coefficients must be stored.
+     */
+    Polynomial view(size_t offset, size_t size) const;
+
+    /**
+     * @brief A shared view of this polynomial extended with zeros to `virtual_size` coefficients, without allocating.
+     * @details Only the stored coefficients are accessible through size(), iterators and spans; operations that are
+     * defined on the full length (MLE evaluation, equality) read the coefficients in [end_index(), virtual_size()) as
+     * zero. Use the size-extending copy constructor where the extended coefficients will be written to.
+     */
+    Polynomial extended_to(size_t virtual_size) const;
+
     std::array<uint8_t, 32> hash() const { return crypto::sha256(byte_span()); }
 
     void clear()
@@ -66,27 +99,35 @@ template <typename Fr> class Polynomial {
         // backing_memory_.reset();
         coefficients_ = nullptr;
         size_ = 0;
+        virtual_padding_ = 0;
+        start_index_ = 0;
     }
 
     bool operator==(Polynomial const& rhs) const;
 
-    // Const and non const versions of coefficient accessors
-    Fr const& operator[](const size_t i) const { return coefficients_[i]; }
+    // Const and non const versions of coefficient accessors. The index must be in [start_index(), end_index()).
+    Fr const& operator[](const size_t i) const { return coefficients_[i - start_index_]; }
 
-    Fr& operator[](const size_t i) { return coefficients_[i]; }
+    Fr& operator[](const size_t i) { return coefficients_[i - start_index_]; }
 
     Fr const& at(const size_t i) const
     {
-        ASSERT(i < capacity());
-        return coefficients_[i];
+        ASSERT(i >= start_index_ && i - start_index_ < capacity());
+        return coefficients_[i - start_index_];
     };
 
     Fr& at(const size_t i)
     {
-        ASSERT(i < capacity());
-        return coefficients_[i];
+        ASSERT(i >= start_index_ && i - start_index_ < capacity());
+        return coefficients_[i - start_index_];
     };
 
+    // The coefficient at any index, which is zero outside of the stored range
+    Fr get(const size_t i) const
+    {
+        return i >= start_index_ && i - start_index_ < size_ ? coefficients_[i - start_index_] : Fr::zero();
+    }
+
     Fr evaluate(const Fr& z, size_t target_size) const;
     Fr evaluate(const Fr& z) const;
 
@@ -125,7 +166,8 @@ template <typename Fr> class Polynomial {
      * @brief Returns an std::span of the left-shift of self.
      *
      * @details If the n coefficients of self are (0, a₁, …, aₙ₋₁),
-     * we returns the view of the n-1 coefficients (a₁, …, aₙ₋₁).
+     * we returns the view of the n-1 coefficients (a₁, …, aₙ₋₁). If start_index() > 0, the view is the same storage
+     * with a start index one lower.
      */
     Polynomial shifted() const;
 
@@ -149,12 +191,19 @@ template <typename Fr> class Polynomial {
      */
     void add_scaled(std::span<const Fr> other, Fr scaling_factor);
 
+    /**
+     * @brief adds the polynomial q(X) 'other', multiplied by a scaling factor, touching only the stored range of q.
+     * @details The stored range of q must lie within that of this polynomial.
+     */
+    void add_scaled(const Polynomial& other, Fr scaling_factor);
+
     /**
      * @brief adds the polynomial q(X) 'other'.
      *
      * @param other q(X)
      */
     Polynomial& operator+=(std::span<const Fr> other);
+    Polynomial& operator+=(const Polynomial& other);
 
     /**
      * @brief subtracts the polynomial q(X) 'other'.
@@ -162,6 +211,7 @@ template <typename Fr> class Polynomial {
      * @param other q(X)
      */
     Polynomial& operator-=(std::span<const Fr> other);
+    Polynomial& operator-=(const Polynomial& other);
 
     /**
      * @brief sets this = p(X) to s⋅p(X)
@@ -174,7 +224,8 @@ template <typename Fr> class Polynomial {
      * @brief evaluates p(X) = ∑ᵢ aᵢ⋅Xⁱ considered as multi-linear extension p(X₀,…,Xₘ₋₁) = ∑ᵢ aᵢ⋅Lᵢ(X₀,…,Xₘ₋₁)
      * at u = (u₀,…,uₘ₋₁)
      *
-     * @details this function allocates a temporary buffer of size n/2
+     * @details this function allocates a temporary buffer of size n/2. Coefficients outside of the active range are
+     * zero and are skipped rather than read, so only the stored part of the polynomial is touched.
      *
      * @param evaluation_points an MLE evaluation point u = (u₀,…,uₘ₋₁)
      * @param shift evaluates p'(X₀,…,Xₘ₋₁) = 1⋅L₀(X₀,…,Xₘ₋₁) + ∑ᵢ˲₁ aᵢ₋₁⋅Lᵢ(X₀,…,Xₘ₋₁) if true
@@ -228,8 +279,14 @@ template <typename Fr> class Polynomial {
     const_iterator end() const { return coefficients_ + size_; }
     const_pointer data() const { return backing_memory_; }
 
+    // The number of stored coefficients, which are those with indices in [start_index(), end_index())
     std::size_t size() const { return size_; }
     std::size_t capacity() const { return size_ + MAXIMUM_COEFFICIENT_SHIFT; }
+    // The polynomial is zero outside of [start_index(), end_index()), its active range
+    std::size_t start_index() const { return start_index_; }
+    std::size_t end_index() const { return start_index_ + size_; }
+    // The length of the polynomial including virtual zeros, e.g. the padding added by extended_to()
+    std::size_t virtual_size() const { return end_index() + virtual_padding_; }
 
     static Polynomial random(const size_t num_coeffs)
     {
@@ -241,11 +298,15 @@ template <typename Fr> class Polynomial {
   private:
     // allocate a fresh memory pointer for backing memory
     // DOES NOT initialize memory
-    void allocate_backing_memory(size_t n_elements);
+    void allocate_backing_memory(size_t n_elements,
+                                 std::source_location location = std::source_location::current());
 
     // safety check for in place operations
     bool in_place_operation_viable(size_t domain_size = 0) { return (size() >= domain_size); }
 
+    // A plain (start_index() == 0) alias of the stored coefficients with indices [start, start + size)
+    Polynomial stored_range(size_t start, size_t size);
+
     void zero_memory_beyond(size_t start_position);
     // When a polynomial is instantiated from a size alone, the memory allocated corresponds to
     // input size + MAXIMUM_COEFFICIENT_SHIFT to support 'shifted' coefficients efficiently.
@@ -261,6 +322,10 @@ template <typename Fr> class Polynomial {
     // 'capacity' of the array. It is not explicitly tied to the degree and is not changed by any operations on the
     // polynomial.
     size_t size_ = 0;
+    // The number of zero coefficients that logically follow the stored ones, see extended_to(). Not backed by memory.
+    size_t virtual_padding_ = 0;
+    // The index of the first stored coefficient. The coefficients before it are zero and not backed by memory.
+    size_t start_index_ = 0;
 };
 
 template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynomial<Fr> const& p)
@@ -268,15 +333,16 @@ template <typename Fr> inline std::ostream& operator<<(std::ostream& os, Polynom
     if (p.size() == 0) {
         return os << "[]";
     }
+    std::span<const Fr> data = p;
     if (p.size() == 1) {
-        return os << "[ data " << p[0] << "]";
+        return os << "[ data " << data[0] << "]";
     }
     return os << "[ data\n"
-              << "  " << p[0] << ",\n"
-              << "  " << p[1] << ",\n"
+              << "  " << data[0] << ",\n"
+              << "  " << data[1] << ",\n"
               << "  ... ,\n"
-              << "  " << p[p.size() - 2] << ",\n"
-              << "  " << p[p.size() - 1] << ",\n"
+              << "  " << data[p.size() - 2] << ",\n"
+              << "  " << data[p.size() - 1] << ",\n"
               << "]";
 }
 
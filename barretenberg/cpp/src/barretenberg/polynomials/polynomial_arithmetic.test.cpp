@@ -1,5 +1,6 @@
 #include "polynomial_arithmetic.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/polynomials/evaluation_domain.hpp"
@@ -1132,6 +1133,101 @@ TYPED_TEST(PolynomialTests, partial_evaluate_mle)
     EXPECT_EQ(v_result, v_expected);
 }
 
+/**
+ * @brief Test that views and virtual zero padding share memory, and behave like a materialised copy
+ *
+ */
+TYPED_TEST(PolynomialTests, views_and_virtual_padding)
+{
+    using FF = TypeParam;
+    const size_t size = 13;
+    const size_t N = 32;
+    Polynomial<FF> poly(size);
+    for (size_t i = 1; i < size; ++i) {
+        poly[i] = FF::random_element();
+    }
+
+    SlabArena arena;
+    auto extended = poly.extended_to(N);
+    auto shifted = poly.shifted();
+    auto middle = poly.view(4, 6);
+    EXPECT_EQ(arena.get_stats().num_allocations, 0);
+
+    EXPECT_EQ(extended.size(), size);
+    EXPECT_EQ(extended.virtual_size(), N);
+    EXPECT_EQ(extended.begin(), poly.begin());
+    EXPECT_EQ(shifted[0], poly[1]);
+    EXPECT_EQ(middle.size(), 6);
+    EXPECT_EQ(middle.start_index(), 4);
+    middle[5] = FF(7);
+    EXPECT_EQ(poly[5], FF(7));
+
+    Polynomial<FF> materialised(poly, N);
+    EXPECT_EQ(extended, materialised);
+    EXPECT_NE(poly, materialised);
+
+    std::vector<FF> u(numeric::get_msb(N));
+    for (auto& u_l : u) {
+        u_l = FF::random_element();
+    }
+    EXPECT_EQ(extended.evaluate_mle(u), materialised.evaluate_mle(u));
+    EXPECT_EQ(extended.evaluate_mle(u, true), materialised.evaluate_mle(u, true));
+    std::vector<FF> u_part = { u[3], u[4] };
+    EXPECT_EQ(extended.partial_evaluate_mle(u_part), materialised.partial_evaluate_mle(u_part));
+
+    // Copies keep the padding
+    Polynomial<FF> copy(extended);
+    EXPECT_EQ(copy.virtual_size(), N);
+    EXPECT_EQ(copy, materialised);
+}
+
+/**
+ * @brief Test that a structured polynomial, which only stores its active range, behaves like the dense polynomial with
+ * the same coefficients
+ *
+ */
+TYPED_TEST(PolynomialTests, structured_polynomial)
+{
+    using FF = TypeParam;
+    const size_t N = 32;
+    const size_t start = 5;
+    const size_t size = 10;
+    Polynomial<FF> structured(size, N, start);
+    Polynomial<FF> dense(N);
+    for (size_t i = start; i < start + size; ++i) {
+        structured[i] = FF::random_element();
+        dense[i] = structured[i];
+    }
+    EXPECT_EQ(structured.start_index(), start);
+    EXPECT_EQ(structured.end_index(), start + size);
+    EXPECT_EQ(structured.virtual_size(), N);
+    EXPECT_EQ(structured.get(start - 1), FF(0));
+    EXPECT_EQ(structured.get(start), dense[start]);
+    EXPECT_EQ(structured.get(start + size), FF(0));
+    EXPECT_EQ(structured, dense);
+    EXPECT_EQ(Polynomial<FF>(structured, N), dense);
+
+    FF z = FF::random_element();
+    EXPECT_EQ(structured.evaluate(z), dense.evaluate(z));
+
+    std::vector<FF> u(numeric::get_msb(N));
+    for (auto& u_l : u) {
+        u_l = FF::random_element();
+    }
+    EXPECT_EQ(structured.evaluate_mle(u), dense.evaluate_mle(u));
+    EXPECT_EQ(structured.evaluate_mle(u, true), dense.evaluate_mle(u, true));
+    EXPECT_EQ(structured.shifted(), dense.shifted());
+    std::vector<FF> u_part = { u[2], u[3], u[4] };
+    EXPECT_EQ(structured.partial_evaluate_mle(u_part), dense.partial_evaluate_mle(u_part));
+
+    // Adding a structured polynomial only touches its range
+    Polynomial<FF> sum = Polynomial<FF>::random(N);
+    Polynomial<FF> expected(sum);
+    sum.add_scaled(structured, FF(3));
+    expected.add_scaled(dense, FF(3));
+    EXPECT_EQ(sum, expected);
+}
+
 TYPED_TEST(PolynomialTests, factor_roots)
 {
     using FF = TypeParam;
@@ -3,6 +3,9 @@
 
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "polynomial_store.hpp"
+#include "polynomial_store_mmap.hpp"
+
+#include <filesystem>
 
 using namespace bb;
 
@@ -85,3 +88,51 @@ TEST(PolynomialStore, Remove)
     EXPECT_THROW(polynomial_store.get("id_1"), std::out_of_range);
     EXPECT_EQ(polynomial_store.get_size_in_bytes(), bytes_expected);
 }
+
+// Polynomials in a file-backed store survive being spilled, and only the most recently used ones count as resident
+TEST(PolynomialStoreMmap, SpillsLeastRecentlyUsed)
+{
+    const size_t size = 1 << 12;
+    const size_t bytes = sizeof(fr) * size;
+    PolynomialStoreMmap<fr> polynomial_store(std::filesystem::temp_directory_path().string(), 2 * bytes);
+    EXPECT_TRUE(polynomial_store.is_file_backed());
+
+    std::vector<Polynomial<fr>> copies;
+    for (size_t i = 0; i < 4; ++i) {
+        auto poly = Polynomial<fr>::random(size);
+        copies.emplace_back(poly);
+        polynomial_store.put("id_" + std::to_string(i), std::move(poly));
+    }
+    EXPECT_EQ(polynomial_store.get_size_in_bytes(), 4 * bytes);
+    EXPECT_EQ(polynomial_store.get_resident_size_in_bytes(), 2 * bytes);
+
+    // id_0 was spilled; reading it back spills id_2, the least recently used
+    auto poly_0 = polynomial_store.get("id_0");
+    EXPECT_EQ(poly_0, copies[0]);
+    EXPECT_EQ(polynomial_store.get_resident_size_in_bytes(), 2 * bytes);
+
+    // Writes through a returned polynomial land in the store, even across a spill
+    poly_0[7] = fr(42);
+    polynomial_store.get("id_1");
+    polynomial_store.get("id_2");
+    EXPECT_EQ(polynomial_store.get("id_0")[7], fr(42));
+    // The padding for shifts is zero
+    EXPECT_EQ(polynomial_store.get("id_3").at(size), fr(0));
+    for (size_t i = 1; i < 4; ++i) {
+        EXPECT_EQ(polynomial_store.get("id_" + std::to_string(i)), copies[i]);
+    }
+
+    polynomial_store.remove("id_0");
+    EXPECT_EQ(polynomial_store.get_size_in_bytes(), 3 * bytes);
+    EXPECT_THROW(polynomial_store.get("id_0"), std::out_of_range);
+}
+
+TEST(PolynomialStoreMmap, HeapWithoutDirectory)
+{
+    PolynomialStoreMmap<fr> polynomial_store("", 0);
+    EXPECT_FALSE(polynomial_store.is_file_backed());
+    auto poly = Polynomial<fr>::random(100);
+    Polynomial<fr> poly_copy(poly);
+    polynomial_store.put("id", std::move(poly));
+    EXPECT_EQ(polynomial_store.get("id"), poly_copy);
+}
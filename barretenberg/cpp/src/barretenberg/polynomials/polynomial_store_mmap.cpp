@@ -0,0 +1,173 @@
+#include "polynomial_store_mmap.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifndef __wasm__
+/**
+ * @brief Copy a polynomial into a shared mapping of a new, already unlinked, file in `directory`. The file lives as
+ * long as the mapping, i.e. until the last polynomial sharing it is destroyed.
+ */
+template <typename Fr> bb::Polynomial<Fr> map_to_file(const bb::Polynomial<Fr>& value, const std::string& directory)
+{
+    // capacity() includes the zero padding for shifts, which the new file provides
+    const size_t num_bytes = value.capacity() * sizeof(Fr);
+    std::string path = directory + "/bb_polynomial_XXXXXX";
+    const int fd = mkstemp(path.data());
+    if (fd < 0) {
+        throw_or_abort("PolynomialStoreMmap: could not create a file in " + directory);
+    }
+    unlink(path.c_str());
+    void* ptr = MAP_FAILED;
+    if (ftruncate(fd, static_cast<off_t>(num_bytes)) == 0) {
+        ptr = mmap(nullptr, num_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        throw_or_abort("PolynomialStoreMmap: could not map " + std::to_string(num_bytes) + " bytes in " + directory);
+    }
+    std::memcpy(ptr, static_cast<const void*>(value.begin()), value.size() * sizeof(Fr));
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<Fr[]> mapping(static_cast<Fr*>(ptr), [num_bytes](Fr* p) { munmap(p, num_bytes); });
+    return bb::Polynomial<Fr>(std::move(mapping), value.size());
+}
+
+// Write the polynomial back to its file and drop its pages. Later accesses page it back in from the file.
+template <typename Fr> void spill(const bb::Polynomial<Fr>& polynomial)
+{
+    void* ptr = static_cast<void*>(polynomial.data().get());
+    const size_t num_bytes = polynomial.capacity() * sizeof(Fr);
+    msync(ptr, num_bytes, MS_SYNC);
+    madvise(ptr, num_bytes, MADV_DONTNEED);
+}
+#endif
+
+} // namespace
+
+namespace bb {
+
+template <typename Fr> PolynomialStoreMmap<Fr>::PolynomialStoreMmap()
+{
+    const char* directory_env = std::getenv("BB_POLYNOMIAL_STORE_DIR");
+    const char* budget_env = std::getenv("BB_POLYNOMIAL_STORE_BUDGET_MB");
+#ifndef __wasm__
+    if (directory_env != nullptr) {
+        directory = directory_env;
+    }
+#else
+    (void)directory_env;
+#endif
+    if (budget_env != nullptr) {
+        resident_budget = std::stoul(budget_env) * 1024 * 1024;
+    }
+}
+
+template <typename Fr>
+PolynomialStoreMmap<Fr>::PolynomialStoreMmap(std::string directory, size_t resident_budget)
+    : directory(std::move(directory))
+    , resident_budget(resident_budget)
+{
+#ifdef __wasm__
+    this->directory.clear();
+#endif
+}
+
+template <typename Fr> void PolynomialStoreMmap<Fr>::put(std::string const& key, Polynomial&& value)
+{
+    if (entries.contains(key)) {
+        remove(key);
+    }
+    Entry& entry = entries[key];
+#ifndef __wasm__
+    if (is_file_backed()) {
+        entry.polynomial = map_to_file(value, directory);
+        value = Polynomial();
+    } else {
+        entry.polynomial = std::move(value);
+    }
+#else
+    entry.polynomial = std::move(value);
+#endif
+    resident_bytes += entry.polynomial.size() * sizeof(Fr);
+    touch(entry);
+    spill_until_within_budget(entry);
+}
+
+template <typename Fr> bb::Polynomial<Fr> PolynomialStoreMmap<Fr>::get(std::string const& key)
+{
+    Entry& entry = entries.at(key);
+    if (!entry.resident) {
+        // It is about to be read, so count it as resident again
+        entry.resident = true;
+        resident_bytes += entry.polynomial.size() * sizeof(Fr);
+    }
+    touch(entry);
+    spill_until_within_budget(entry);
+    return entry.polynomial.share();
+}
+
+template <typename Fr> void PolynomialStoreMmap<Fr>::remove(std::string const& key)
+{
+    ASSERT(entries.contains(key));
+    const Entry& entry = entries.at(key);
+    if (entry.resident) {
+        resident_bytes -= entry.polynomial.size() * sizeof(Fr);
+    }
+    entries.erase(key);
+}
+
+template <typename Fr> size_t PolynomialStoreMmap<Fr>::get_size_in_bytes() const
+{
+    size_t size_in_bytes = 0;
+    for (auto& [key, entry] : entries) {
+        size_in_bytes += sizeof(Fr) * entry.polynomial.size();
+    }
+    return size_in_bytes;
+}
+
+template <typename Fr> void PolynomialStoreMmap<Fr>::touch(Entry& entry)
+{
+    entry.last_use = ++clock;
+}
+
+/**
+ * @brief Spill least recently used polynomials, other than `keep`, until the resident estimate fits the budget. A
+ * linear scan per spill is fine, as proving keys hold at most a few hundred polynomials.
+ */
+template <typename Fr> void PolynomialStoreMmap<Fr>::spill_until_within_budget([[maybe_unused]] const Entry& keep)
+{
+#ifndef __wasm__
+    if (!is_file_backed() || resident_budget == 0) {
+        return;
+    }
+    while (resident_bytes > resident_budget) {
+        Entry* oldest = nullptr;
+        for (auto& [key, entry] : entries) {
+            if (entry.resident && &entry != &keep && (oldest == nullptr || entry.last_use < oldest->last_use)) {
+                oldest = &entry;
+            }
+        }
+        if (oldest == nullptr) {
+            return;
+        }
+        spill(oldest->polynomial);
+        oldest->resident = false;
+        resident_bytes -= oldest->polynomial.size() * sizeof(Fr);
+    }
+#endif
+}
+
+template class PolynomialStoreMmap<bb::fr>;
+
+} // namespace bb
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace bb {
+
+/**
+ * A PolynomialStore for proving keys that don't fit in RAM. Each polynomial put into the store is moved into its own
+ * file-backed shared mapping (an unlinked temporary file in `directory`), so the OS pages it in on demand and can
+ * write it back and drop it under pressure. Polynomials returned by get() share the mapping, as with PolynomialStore.
+ *
+ * The store also keeps an estimate of how much of it is resident. Whenever that exceeds `resident_budget` bytes, the
+ * least recently used polynomials (by put/get) are spilled: synced to their file and dropped from memory. Spilling a
+ * polynomial that is still in use is safe, it is just paged back in as it is read. A budget of 0 means no budget.
+ *
+ * The default constructor reads BB_POLYNOMIAL_STORE_DIR and BB_POLYNOMIAL_STORE_BUDGET_MB. Without a directory (and
+ * always in WASM, which has no mmap) polynomials stay on the heap and the store behaves exactly like PolynomialStore.
+ */
+template <typename Fr> class PolynomialStoreMmap {
+  private:
+    using Polynomial = bb::Polynomial<Fr>;
+
+    struct Entry {
+        Polynomial polynomial;
+        size_t last_use = 0;
+        bool resident = true;
+    };
+
+    std::unordered_map<std::string, Entry> entries;
+    std::string directory;
+    size_t resident_budget = 0;
+    size_t resident_bytes = 0;
+    size_t clock = 0;
+
+  public:
+    PolynomialStoreMmap();
+    PolynomialStoreMmap(std::string directory, size_t resident_budget);
+
+    /**
+     * Transfer ownership of a polynomial to the store. If the store is file-backed, the coefficients are copied into a
+     * new mapping and the polynomial's heap memory is released.
+     */
+    void put(std::string const& key, Polynomial&& value);
+
+    /**
+     * Returns a shallow copy of a polynomial. Throws std::out_of_range if the key does not exist.
+     */
+    Polynomial get(std::string const& key);
+
+    void remove(std::string const& key);
+
+    size_t get_size_in_bytes() const;
+
+    // Estimated bytes of the stored polynomials currently in memory
+    size_t get_resident_size_in_bytes() const { return resident_bytes; }
+
+    bool is_file_backed() const { return !directory.empty(); }
+
+    bool contains(std::string const& key) { return entries.contains(key); };
+    size_t size() { return entries.size(); };
+
+  private:
+    void touch(Entry& entry);
+    void spill_until_within_budget(const Entry& keep);
+};
+
+} // namespace bb
@@ -77,6 +77,19 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         return { prover_accumulator, verifier_accumulator };
     }
 
+    template <size_t NUM>
+    static std::tuple<std::shared_ptr<ProverInstance>, std::shared_ptr<VerifierInstance>> fold_and_verify_multiple(
+        const std::vector<std::shared_ptr<ProverInstance>>& prover_instances,
+        const std::vector<std::shared_ptr<VerifierInstance>>& verifier_instances)
+    {
+        ProtoGalaxyProver_<ProverInstances_<Flavor, NUM>> folding_prover(prover_instances);
+        ProtoGalaxyVerifier_<VerifierInstances_<Flavor, NUM>> folding_verifier(verifier_instances);
+
+        auto [prover_accumulator, folding_proof] = folding_prover.fold_instances();
+        auto verifier_accumulator = folding_verifier.verify_folding_proof(folding_proof);
+        return { prover_accumulator, verifier_accumulator };
+    }
+
     static void check_accumulator_target_sum_manual(std::shared_ptr<ProverInstance>& accumulator, bool expected_result)
     {
         auto instance_size = accumulator->proving_key.circuit_size;
@@ -163,6 +176,49 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         }
     }
 
+    /**
+     * @brief Check the perturbator coefficients computed from random \vec{β}, \vec{δ} and f_i(ω) against the direct
+     * formula F(X) = ∑ᵢ f_i(ω) ∏_{l : bit l of i is set} (β_l + δ_l X). The tree is large enough to be split between
+     * threads.
+     *
+     */
+    static void test_pertubator_coefficients_random()
+    {
+        const size_t log_instance_size = 10;
+        const size_t instance_size = 1 << log_instance_size;
+        std::vector<FF> betas(log_instance_size);
+        std::vector<FF> deltas(log_instance_size);
+        for (size_t l = 0; l < log_instance_size; ++l) {
+            betas[l] = FF::random_element();
+            deltas[l] = FF::random_element();
+        }
+        std::vector<FF> full_honk_evaluations(instance_size);
+        for (auto& eval : full_honk_evaluations) {
+            eval = FF::random_element();
+        }
+
+        std::vector<FF> expected_values(log_instance_size + 1, FF(0));
+        for (size_t i = 0; i < instance_size; ++i) {
+            std::vector<FF> term = { full_honk_evaluations[i] };
+            for (size_t l = 0; l < log_instance_size; ++l) {
+                if (((i >> l) & 1) == 1) {
+                    std::vector<FF> product(term.size() + 1, FF(0));
+                    for (size_t d = 0; d < term.size(); ++d) {
+                        product[d] += term[d] * betas[l];
+                        product[d + 1] += term[d] * deltas[l];
+                    }
+                    term = product;
+                }
+            }
+            for (size_t d = 0; d < term.size(); ++d) {
+                expected_values[d] += term[d];
+            }
+        }
+
+        auto perturbator = ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+        EXPECT_EQ(perturbator, expected_values);
+    }
+
     /**
      * @brief Create a dummy accumulator and ensure coefficient 0 of the computed perturbator is the same as the
      * accumulator's target sum.
@@ -215,6 +271,49 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         EXPECT_EQ(perturbator[0], target_sum);
     }
 
+    /**
+     * @brief Check that the perturbator computed in a single streaming pass over the rows matches the one built from
+     * the full Honk evaluations at all rows, for an instance spanning several chunks of leaves.
+     *
+     */
+    static void test_pertubator_polynomial_streaming()
+    {
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        const size_t log_instance_size = ProtoGalaxyProver::LOG_PERTURBATOR_CHUNK_SIZE + 1;
+        const size_t instance_size(1 << log_instance_size);
+        std::array<bb::Polynomial<FF>, Flavor::NUM_ALL_ENTITIES> random_polynomials;
+        for (auto& poly : random_polynomials) {
+            poly = bb::Polynomial<FF>::random(instance_size);
+        }
+        auto full_polynomials = construct_full_prover_polynomials(random_polynomials);
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+        std::vector<FF> betas(log_instance_size);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        auto deltas = ProtoGalaxyProver::compute_round_challenge_pows(log_instance_size, FF::random_element());
+
+        auto full_honk_evals =
+            ProtoGalaxyProver::compute_full_honk_evaluations(full_polynomials, alphas, relation_parameters);
+        auto expected_values = ProtoGalaxyProver::construct_perturbator_coefficients(betas, deltas, full_honk_evals);
+
+        auto accumulator = std::make_shared<ProverInstance>();
+        accumulator->prover_polynomials = std::move(full_polynomials);
+        accumulator->gate_challenges = betas;
+        accumulator->relation_parameters = relation_parameters;
+        accumulator->alphas = alphas;
+        auto perturbator = ProtoGalaxyProver::compute_perturbator(accumulator, deltas);
+
+        EXPECT_EQ(perturbator.size(), log_instance_size + 1);
+        for (size_t i = 0; i < perturbator.size(); i++) {
+            EXPECT_EQ(perturbator[i], expected_values[i]);
+        }
+    }
+
     /**
      * @brief Manually compute the expected evaluations of the combiner quotient, given evaluations of the combiner
      * and check them against the evaluations returned by the function.
@@ -293,6 +392,42 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         }
     }
 
+    /**
+     * @brief Check that skipping the gated relations on the padding rows of the execution traces does not change the
+     * combiner.
+     *
+     */
+    static void test_combiner_skips_padding()
+    {
+        std::vector<std::shared_ptr<ProverInstance>> prover_instances;
+        for (size_t idx = 0; idx < 2; idx++) {
+            auto builder = typename Flavor::CircuitBuilder();
+            construct_circuit(builder);
+            prover_instances.emplace_back(std::make_shared<ProverInstance>(builder));
+            EXPECT_GT(prover_instances.back()->proving_key.active_trace_end, 0);
+            EXPECT_LT(prover_instances.back()->proving_key.active_trace_end,
+                      prover_instances.back()->proving_key.circuit_size);
+        }
+        FoldingProver folding_prover(prover_instances);
+        folding_prover.prepare_for_folding();
+        auto& instances = folding_prover.instances;
+        ProtoGalaxyProver::combine_relation_parameters(instances);
+        ProtoGalaxyProver::combine_alpha(instances);
+        std::vector<FF> betas(instances[0]->proving_key.log_circuit_size);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        auto pow_polynomial = PowPolynomial(betas);
+        auto combiner = folding_prover.compute_combiner(instances, pow_polynomial);
+
+        // Forget where the traces end, so that every relation is accumulated at every row
+        for (auto& instance : instances) {
+            instance->proving_key.active_trace_end = 0;
+        }
+        auto expected_combiner = folding_prover.compute_combiner(instances, pow_polynomial);
+        EXPECT_EQ(combiner, expected_combiner);
+    }
+
     /**
      * @brief Testing two valid rounds of folding followed by the decider.
      *
@@ -330,6 +465,70 @@ template <typename Flavor> class ProtoGalaxyTests : public testing::Test {
         decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
     }
 
+    /**
+     * @brief Check the vanishing polynomial and the Lagrange basis of the folding domain {0, ..., k - 1}.
+     *
+     */
+    static void test_lagrange_polynomials()
+    {
+        constexpr size_t NUM = 4;
+        for (size_t point = 0; point < NUM; point++) {
+            EXPECT_EQ(compute_vanishing_polynomial<NUM>(FF(point)), FF(0));
+            auto lagranges = compute_lagrange_polynomials<NUM>(FF(point));
+            for (size_t i = 0; i < NUM; i++) {
+                EXPECT_EQ(lagranges[i], FF(i == point ? 1 : 0));
+            }
+        }
+        // The basis sums to 1 everywhere and matches {1 - X, X} for two instances
+        FF challenge = FF::random_element();
+        FF sum = 0;
+        for (const auto& lagrange : compute_lagrange_polynomials<NUM>(challenge)) {
+            sum += lagrange;
+        }
+        EXPECT_EQ(sum, FF(1));
+        EXPECT_EQ(compute_vanishing_polynomial<NUM>(challenge),
+                  challenge * (challenge - FF(1)) * (challenge - FF(2)) * (challenge - FF(3)));
+        auto lagranges = compute_lagrange_polynomials<2>(challenge);
+        EXPECT_EQ(lagranges[0], FF(1) - challenge);
+        EXPECT_EQ(lagranges[1], challenge);
+    }
+
+    /**
+     * @brief Testing two valid rounds of folding four instances at once, followed by the decider.
+     *
+     */
+    static void test_full_protogalaxy_multiple_instances()
+    {
+        constexpr size_t NUM = 4;
+        const auto construct_instances = [](size_t num_instances) {
+            std::vector<std::shared_ptr<ProverInstance>> prover_instances;
+            std::vector<std::shared_ptr<VerifierInstance>> verifier_instances;
+            for (size_t idx = 0; idx < num_instances; idx++) {
+                auto builder = typename Flavor::CircuitBuilder();
+                construct_circuit(builder);
+                auto prover_instance = std::make_shared<ProverInstance>(builder);
+                auto verification_key = std::make_shared<VerificationKey>(prover_instance->proving_key);
+                prover_instances.emplace_back(prover_instance);
+                verifier_instances.emplace_back(std::make_shared<VerifierInstance>(verification_key));
+            }
+            return std::make_tuple(prover_instances, verifier_instances);
+        };
+
+        auto [prover_instances, verifier_instances] = construct_instances(NUM);
+        auto [prover_accumulator, verifier_accumulator] =
+            fold_and_verify_multiple<NUM>(prover_instances, verifier_instances);
+        check_accumulator_target_sum_manual(prover_accumulator, true);
+
+        auto [next_prover_instances, next_verifier_instances] = construct_instances(NUM - 1);
+        next_prover_instances.insert(next_prover_instances.begin(), prover_accumulator);
+        next_verifier_instances.insert(next_verifier_instances.begin(), verifier_accumulator);
+        auto [prover_accumulator_2, verifier_accumulator_2] =
+            fold_and_verify_multiple<NUM>(next_prover_instances, next_verifier_instances);
+        check_accumulator_target_sum_manual(prover_accumulator_2, true);
+
+        decide_and_verify(prover_accumulator_2, verifier_accumulator_2, true);
+    }
+
     /**
      * @brief Ensure tampering a commitment and then calling the decider causes the decider verification to fail.
      *
@@ -414,6 +613,11 @@ TYPED_TEST(ProtoGalaxyTests, PerturbatorCoefficients)
     TestFixture::test_pertubator_coefficients();
 }
 
+TYPED_TEST(ProtoGalaxyTests, PerturbatorCoefficientsRandom)
+{
+    TestFixture::test_pertubator_coefficients_random();
+}
+
 TYPED_TEST(ProtoGalaxyTests, FullHonkEvaluationsValidCircuit)
 {
     TestFixture::test_full_honk_evaluations_valid_circuit();
@@ -424,6 +628,11 @@ TYPED_TEST(ProtoGalaxyTests, PerturbatorPolynomial)
     TestFixture::test_pertubator_polynomial();
 }
 
+TYPED_TEST(ProtoGalaxyTests, PerturbatorPolynomialStreaming)
+{
+    TestFixture::test_pertubator_polynomial_streaming();
+}
+
 TYPED_TEST(ProtoGalaxyTests, CombinerQuotient)
 {
     TestFixture::test_combiner_quotient();
@@ -439,11 +648,26 @@ TYPED_TEST(ProtoGalaxyTests, CombineAlpha)
     TestFixture::test_combine_alpha();
 }
 
+TYPED_TEST(ProtoGalaxyTests, CombinerSkipsPadding)
+{
+    TestFixture::test_combiner_skips_padding();
+}
+
 TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyTest)
 {
     TestFixture::test_full_protogalaxy();
 }
 
+TYPED_TEST(ProtoGalaxyTests, LagrangePolynomials)
+{
+    TestFixture::test_lagrange_polynomials();
+}
+
+TYPED_TEST(ProtoGalaxyTests, FullProtogalaxyMultipleInstances)
+{
+    TestFixture::test_full_protogalaxy_multiple_instances();
+}
+
 TYPED_TEST(ProtoGalaxyTests, TamperedCommitment)
 {
     TestFixture::test_tampered_commitment();
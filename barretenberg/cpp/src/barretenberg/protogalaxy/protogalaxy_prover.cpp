@@ -44,11 +44,9 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
 {
     auto combiner_quotient_at_challenge = combiner_quotient.evaluate(challenge);
 
-    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma),L_1(\gamma)}
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/764): Generalize the vanishing polynomial formula
-    // and the computation of Lagrange basis for k instances
-    auto vanishing_polynomial_at_challenge = challenge * (challenge - FF(1));
-    std::vector<FF> lagranges{ FF(1) - challenge, challenge };
+    // Given the challenge \gamma, compute Z(\gamma) and {L_0(\gamma), ..., L_{k-1}(\gamma)}
+    auto vanishing_polynomial_at_challenge = compute_vanishing_polynomial<ProverInstances::NUM>(challenge);
+    auto lagranges = compute_lagrange_polynomials<ProverInstances::NUM>(challenge);
 
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/881): bad pattern
     auto next_accumulator = std::move(instances[0]);
@@ -90,7 +88,7 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
     size_t el_idx = 0;
     for (auto& el : next_accumulator->proving_key.public_inputs) {
         el *= lagranges[0];
-        size_t inst = 0;
+        size_t inst = 1;
         for (size_t inst_idx = 1; inst_idx < ProverInstances::NUM; inst_idx++) {
             auto& instance = instances[inst_idx];
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/830)
@@ -123,6 +121,8 @@ std::shared_ptr<typename ProverInstances::Instance> ProtoGalaxyProver_<ProverIns
     };
     next_accumulator->relation_parameters = folded_relation_parameters;
     next_accumulator->proving_key = std::move(instances[0]->proving_key);
+    // The folded selectors vanish wherever those of all the instances do
+    next_accumulator->proving_key.active_trace_end = instances.get_active_trace_end();
     // Derive the prover polynomials from the proving key polynomials since we only fold the unshifted polynomials. This
     // is extremely cheap since we only call .share() and .shifted() polynomial functions. We need the folded prover
     // polynomials for the decider.
@@ -197,4 +197,6 @@ FoldingResult<typename ProverInstances::Flavor> ProtoGalaxyProver_<ProverInstanc
 
 template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 2>>;
 template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 2>>;
+template class ProtoGalaxyProver_<ProverInstances_<UltraFlavor, 4>>;
+template class ProtoGalaxyProver_<ProverInstances_<GoblinUltraFlavor, 4>>;
 } // namespace bb
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "barretenberg/polynomials/pow.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
 #include "barretenberg/protogalaxy/folding_result.hpp"
+#include "barretenberg/protogalaxy/prover_verifier_shared.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/stdlib_circuit_builders/goblin_ultra_flavor.hpp"
@@ -61,6 +62,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     using RelationEvaluations = typename Flavor::TupleOfArraysOfValues;
 
     static constexpr size_t NUM_SUBRELATIONS = ProverInstances::NUM_SUBRELATIONS;
+    // log of the number of leaves of the perturbator tree each thread computes and reduces at a time
+    static constexpr size_t LOG_PERTURBATOR_CHUNK_SIZE = 10;
 
     ProverInstances instances;
     std::shared_ptr<Transcript> transcript = std::make_shared<Transcript>();
@@ -131,6 +134,40 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     // FoldingParameters set and be the result of a previous round of folding.
     std::shared_ptr<Instance> get_accumulator() { return instances[0]; }
 
+    /**
+     * @brief Compute the value of the full Honk relation at a single row of the execution trace, i.e. f_i(ω) for i =
+     * row, given the evaluations of all the prover polynomials and \vec{α} (the batching challenges that help
+     * establishing each subrelation is independently valid in Honk - from the Plonk paper, DO NOT confuse with α in
+     * ProtoGalaxy).
+     *
+     * @details The contribution of the linearly dependent subrelations, which act on the entire execution trace rather
+     * than on a single row, is not part of the returned value; it is added to `linearly_dependent_contribution`.
+     */
+    static FF compute_full_honk_evaluation(const ProverPolynomials& instance_polynomials,
+                                           const RelationSeparator& alpha,
+                                           const RelationParameters<FF>& relation_parameters,
+                                           const size_t row,
+                                           FF& linearly_dependent_contribution)
+    {
+        auto row_evaluations = instance_polynomials.get_row(row);
+        RelationEvaluations relation_evaluations;
+        Utils::zero_elements(relation_evaluations);
+
+        // Note that the evaluations are accumulated with the gate separation challenge being 1 at this stage, as this
+        // specific randomness is added later through the power polynomial univariate specific to ProtoGalaxy
+        Utils::template accumulate_relation_evaluations<>(
+            row_evaluations, relation_evaluations, relation_parameters, FF(1));
+
+        auto output = FF(0);
+        auto running_challenge = FF(1);
+
+        // Sum relation evaluations, batched by their corresponding relation separator challenge, to get the value of
+        // the full honk relation at a specific row
+        Utils::scale_and_batch_elements(
+            relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
+        return output;
+    }
+
     /**
      * @brief Compute the values of the full Honk relation at each row in the execution trace, representing f_i(ω) in
      * the ProtoGalaxy paper, given the evaluations of all the prover polynomials and \vec{α} (the batching challenges
@@ -149,7 +186,6 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     {
         auto instance_size = instance_polynomials.get_polynomial_size();
         std::vector<FF> full_honk_evaluations(instance_size);
-        std::vector<FF> linearly_dependent_contributions(instance_size);
 #ifndef NO_MULTITHREADING
         std::mutex evaluation_mutex;
 #endif
@@ -157,27 +193,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         run_loop_in_parallel(instance_size, [&](size_t start_row, size_t end_row) {
             auto thread_accumulator = FF(0);
             for (size_t row = start_row; row < end_row; row++) {
-                auto row_evaluations = instance_polynomials.get_row(row);
-                RelationEvaluations relation_evaluations;
-                Utils::zero_elements(relation_evaluations);
-
-                // Note that the evaluations are accumulated with the gate separation challenge
-                // being 1 at this stage, as this specific randomness is added later through the
-                // power polynomial univariate specific to ProtoGalaxy
-                Utils::template accumulate_relation_evaluations<>(
-                    row_evaluations, relation_evaluations, relation_parameters, FF(1));
-
-                auto output = FF(0);
-                auto running_challenge = FF(1);
-
-                // Sum relation evaluations, batched by their corresponding relation separator challenge, to
-                // get the value of the full honk relation at a specific row
-                auto linearly_dependent_contribution = FF(0);
-                Utils::scale_and_batch_elements(
-                    relation_evaluations, alpha, running_challenge, output, linearly_dependent_contribution);
-                thread_accumulator += linearly_dependent_contribution;
-
-                full_honk_evaluations[row] = output;
+                full_honk_evaluations[row] = compute_full_honk_evaluation(
+                    instance_polynomials, alpha, relation_parameters, row, thread_accumulator);
             }
             {
 #ifndef NO_MULTITHREADING
@@ -191,34 +208,37 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     }
 
     /**
-     * @brief  Recursively compute the parent nodes of each level in the tree, starting from the leaves. Note that at
-     * each level, the resulting parent nodes will be polynomials of degree (level+1) because we multiply by an
-     * additional factor of X.
+     * @brief Compute the parent nodes of `num_levels` consecutive levels of the tree, starting from the nodes of degree
+     * `level` stored contiguously in `coeffs` with level + 1 coefficients each. The result overwrites `coeffs`: the
+     * root of the subtree ends up in its first level + num_levels + 1 entries.
+     * @details The parent of the nodes 2i and 2i + 1 at level l is n_{2i} + n_{2i+1} * (β_l + δ_l X), so each parent
+     * has one more coefficient than its children. A parent is only written over its own children and the nodes to
+     * their left, which have already been consumed, so the levels can be computed in place.
      */
-    static std::vector<FF> construct_coefficients_tree(const std::vector<FF>& betas,
-                                                       const std::vector<FF>& deltas,
-                                                       const std::vector<std::vector<FF>>& prev_level_coeffs,
-                                                       size_t level = 1)
+    static void construct_coefficients_tree(std::span<FF> coeffs,
+                                            const std::vector<FF>& betas,
+                                            const std::vector<FF>& deltas,
+                                            size_t level,
+                                            const size_t num_levels)
     {
-        // if we are at level t in the tree, where t = logn and n is the instance size, we have reached the root which
-        // contains the coefficients of the perturbator polynomial
-        if (level == betas.size()) {
-            return prev_level_coeffs[0];
-        }
-
-        auto degree = level + 1;
-        auto prev_level_width = prev_level_coeffs.size();
-        // we need degree + 1 terms to represent the intermediate polynomials
-        std::vector<std::vector<FF>> level_coeffs(prev_level_width >> 1, std::vector<FF>(degree + 1, 0));
-        for (size_t node = 0; node < prev_level_width; node += 2) {
-            auto parent = node >> 1;
-            std::copy(prev_level_coeffs[node].begin(), prev_level_coeffs[node].end(), level_coeffs[parent].begin());
-            for (size_t d = 0; d < degree; d++) {
-                level_coeffs[parent][d] += prev_level_coeffs[node + 1][d] * betas[level];
-                level_coeffs[parent][d + 1] += prev_level_coeffs[node + 1][d] * deltas[level];
+        size_t width = coeffs.size() / (level + 1);
+        std::vector<FF> parent(level + num_levels + 1);
+        for (const size_t end_level = level + num_levels; level < end_level; ++level) {
+            const size_t num_coeffs = level + 1;
+            for (size_t node = 0; node < width; node += 2) {
+                const FF* left = &coeffs[node * num_coeffs];
+                const FF* right = left + num_coeffs;
+                for (size_t d = 0; d < num_coeffs; d++) {
+                    parent[d] = left[d] + right[d] * betas[level];
+                }
+                parent[num_coeffs] = 0;
+                for (size_t d = 0; d < num_coeffs; d++) {
+                    parent[d + 1] += right[d] * deltas[level];
+                }
+                std::copy_n(parent.begin(), num_coeffs + 1, &coeffs[(node >> 1) * (num_coeffs + 1)]);
             }
+            width >>= 1;
         }
-        return construct_coefficients_tree(betas, deltas, level_coeffs, level + 1);
     }
 
     /**
@@ -228,38 +248,103 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
      * the tree, label the branch connecting the left node n_l to its parent by 1 and for the right node n_r by β_i +
      * δ_i X. The value of the parent node n will be constructed as n = n_l + n_r * (β_i + δ_i X). Recurse over each
      * layer until the root is reached which will correspond to the perturbator polynomial F(X).
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/745): make computation of perturbator more memory
-     * efficient, operate in-place and use std::resize; add multithreading
+     *
+     * @details The leaves are never materialised all at once: `compute_leaves(start, leaves)` fills a chunk of
+     * consecutive leaves starting at `start` and returns the linearly dependent contribution of these rows (see
+     * compute_full_honk_evaluations). Each thread handles a contiguous block of leaves chunk by chunk, reducing every
+     * chunk to its subtree root in place while it is still in cache. The chunk roots, and then the roots of the thread
+     * blocks, are reduced in the same way. The total linearly dependent contribution is added to the constant
+     * coefficient, since leaf 0 is multiplied by 1 on its way to the root.
+     */
+    template <typename LeafFunction>
+    static std::vector<FF> construct_perturbator_tree(const std::vector<FF>& betas,
+                                                      const std::vector<FF>& deltas,
+                                                      const size_t width,
+                                                      const LeafFunction& compute_leaves)
+    {
+        const size_t log_width = numeric::get_msb(width);
+        ASSERT(width == (static_cast<size_t>(1) << log_width) && betas.size() == log_width);
+
+        // each thread handles a power of two number of leaves, split in chunks of a power of two size
+        const size_t num_threads = calculate_num_threads_pow2(width >> 1);
+        const size_t log_num_threads = numeric::get_msb(num_threads);
+        const size_t leaves_per_thread = width / num_threads;
+        const size_t log_leaves_per_thread = log_width - log_num_threads;
+        const size_t log_chunk_size = std::min(LOG_PERTURBATOR_CHUNK_SIZE, log_leaves_per_thread);
+        const size_t chunk_size = static_cast<size_t>(1) << log_chunk_size;
+        const size_t num_chunks = leaves_per_thread / chunk_size;
+
+        const size_t num_root_coeffs = log_leaves_per_thread + 1;
+        std::vector<FF> roots(num_threads * num_root_coeffs);
+        std::vector<FF> linearly_dependent_contributions(num_threads, FF(0));
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const size_t num_chunk_root_coeffs = log_chunk_size + 1;
+            std::vector<FF> leaves(chunk_size);
+            std::vector<FF> chunk_roots(num_chunks * num_chunk_root_coeffs);
+            for (size_t chunk_idx = 0; chunk_idx < num_chunks; ++chunk_idx) {
+                const size_t start = thread_idx * leaves_per_thread + chunk_idx * chunk_size;
+                linearly_dependent_contributions[thread_idx] += compute_leaves(start, std::span<FF>(leaves));
+                construct_coefficients_tree(leaves, betas, deltas, /*level=*/0, log_chunk_size);
+                std::copy_n(leaves.begin(), num_chunk_root_coeffs, &chunk_roots[chunk_idx * num_chunk_root_coeffs]);
+            }
+            construct_coefficients_tree(
+                chunk_roots, betas, deltas, log_chunk_size, log_leaves_per_thread - log_chunk_size);
+            std::copy_n(chunk_roots.begin(), num_root_coeffs, &roots[thread_idx * num_root_coeffs]);
+        });
+
+        // build the top of the tree from the roots of the thread blocks
+        construct_coefficients_tree(roots, betas, deltas, log_leaves_per_thread, log_num_threads);
+        roots.resize(log_width + 1);
+        for (const FF& contribution : linearly_dependent_contributions) {
+            roots[0] += contribution;
+        }
+        return roots;
+    }
+
+    /**
+     * @brief Construct the coefficients of the perturbator polynomial from the evaluations f_i(ω) of the full Honk
+     * relation at every row, see construct_perturbator_tree.
      */
     static std::vector<FF> construct_perturbator_coefficients(const std::vector<FF>& betas,
                                                               const std::vector<FF>& deltas,
                                                               const std::vector<FF>& full_honk_evaluations)
     {
-        auto width = full_honk_evaluations.size();
-        std::vector<std::vector<FF>> first_level_coeffs(width >> 1, std::vector<FF>(2, 0));
-        for (size_t node = 0; node < width; node += 2) {
-            auto parent = node >> 1;
-            first_level_coeffs[parent][0] = full_honk_evaluations[node] + full_honk_evaluations[node + 1] * betas[0];
-            first_level_coeffs[parent][1] = full_honk_evaluations[node + 1] * deltas[0];
-        }
-        return construct_coefficients_tree(betas, deltas, first_level_coeffs);
+        return construct_perturbator_tree(
+            betas, deltas, full_honk_evaluations.size(), [&](size_t start, std::span<FF> leaves) {
+                std::copy_n(&full_honk_evaluations[start], leaves.size(), leaves.begin());
+                return FF(0);
+            });
     }
 
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator, representing the
      * relaxed instance.
      *
-     *
+     * @details The full Honk relation is evaluated chunk by chunk and each chunk is folded into the perturbator tree
+     * right away, so the evaluations at all rows are never held in memory at once.
      */
     static Polynomial<FF> compute_perturbator(const std::shared_ptr<Instance> accumulator,
                                               const std::vector<FF>& deltas)
     {
         BB_OP_COUNT_TIME();
-        auto full_honk_evaluations = compute_full_honk_evaluations(
-            accumulator->prover_polynomials, accumulator->alphas, accumulator->relation_parameters);
+        const auto& instance_polynomials = accumulator->prover_polynomials;
         const auto betas = accumulator->gate_challenges;
         assert(betas.size() == deltas.size());
-        auto coeffs = construct_perturbator_coefficients(betas, deltas, full_honk_evaluations);
+        auto coeffs = construct_perturbator_tree(
+            betas,
+            deltas,
+            instance_polynomials.get_polynomial_size(),
+            [&](size_t start_row, std::span<FF> leaves) {
+                auto linearly_dependent_contribution = FF(0);
+                for (size_t idx = 0; idx < leaves.size(); ++idx) {
+                    leaves[idx] = compute_full_honk_evaluation(instance_polynomials,
+                                                               accumulator->alphas,
+                                                               accumulator->relation_parameters,
+                                                               start_row + idx,
+                                                               linearly_dependent_contribution);
+                }
+                return linearly_dependent_contribution;
+            });
         return Polynomial<FF>(coeffs);
     }
 
@@ -283,31 +368,47 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
         }
     }
 
+    /**
+     * @brief Add the contribution of each relation at a row to the univariate accumulators.
+     * @details Relations gated by a selector (see e.g. UltraArithmeticRelationImpl::get_gate_selector) vanish on the
+     * rows holding no gate in any instance, so they are skipped there.
+     */
     template <typename Parameters, size_t relation_idx = 0>
     void accumulate_relation_univariates(TupleOfTuplesOfUnivariates& univariate_accumulators,
                                          const ExtendedUnivariates& extended_univariates,
                                          const Parameters& relation_parameters,
-                                         const FF& scaling_factor)
+                                         const FF& scaling_factor,
+                                         const bool row_has_gates = true)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        Relation::accumulate(
-            std::get<relation_idx>(univariate_accumulators), extended_univariates, relation_parameters, scaling_factor);
+        constexpr bool is_gated = requires { Relation::get_gate_selector(extended_univariates); };
+        if (!is_gated || row_has_gates) {
+            Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                 extended_univariates,
+                                 relation_parameters,
+                                 scaling_factor);
+        }
 
         // Repeat for the next relation.
         if constexpr (relation_idx + 1 < Flavor::NUM_RELATIONS) {
             accumulate_relation_univariates<Parameters, relation_idx + 1>(
-                univariate_accumulators, extended_univariates, relation_parameters, scaling_factor);
+                univariate_accumulators, extended_univariates, relation_parameters, scaling_factor, row_has_gates);
         }
     }
 
     /**
      * @brief Compute the combiner polynomial $G$ in the Protogalaxy paper.
      *
+     * @details Past the last block of the execution trace of every instance (see ProverInstances_::get_active_trace_end)
+     * the rows are padding, on which only the relations that are not gated by a selector, such as the grand product
+     * relations, need to be accumulated.
      */
     ExtendedUnivariateWithRandomization compute_combiner(const ProverInstances& instances, PowPolynomial<FF>& pow_betas)
     {
         BB_OP_COUNT_TIME();
         size_t common_instance_size = instances[0]->proving_key.circuit_size;
+        const size_t active_trace_end = instances.get_active_trace_end();
+        const size_t gates_end = active_trace_end == 0 ? common_instance_size : active_trace_end;
         pow_betas.compute_values();
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
@@ -348,7 +449,8 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
                     thread_univariate_accumulators[thread_idx],
                     extended_univariates[thread_idx],
                     instances.relation_parameters, // these parameters have already been folded
-                    pow_challenge);
+                    pow_challenge,
+                    /*row_has_gates=*/idx < gates_end);
             }
         });
 
@@ -384,28 +486,30 @@ template <class ProverInstances_> class ProtoGalaxyProver_ {
     /**
      * @brief Compute the combiner quotient defined as $K$ polynomial in the paper.
      *
-     * TODO(https://github.com/AztecProtocol/barretenberg/issues/764): generalize the computation of vanishing
-     * polynomials and Lagrange basis and use batch_invert.
-     *
+     * @details K(X) = (G(X) - F(α) L_0(X)) / Z(X), where Z is the vanishing polynomial of the domain {0, ..., k - 1}
+     * of the k instances and L_0 the first Lagrange polynomial over that domain. K is computed as evaluations at the
+     * points outside the domain, with a single batch inversion of the values of Z.
      */
     static Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> compute_combiner_quotient(
         const FF compressed_perturbator, ExtendedUnivariateWithRandomization combiner)
     {
-        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - ProverInstances::NUM> combiner_quotient_evals = {};
+        constexpr size_t NUM = ProverInstances::NUM;
+        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - NUM> combiner_quotient_evals = {};
+        std::array<FF, ProverInstances::BATCHED_EXTENDED_LENGTH - NUM> vanishing_polynomial_evals = {};
+        for (size_t point = NUM; point < combiner.size(); point++) {
+            vanishing_polynomial_evals[point - NUM] = compute_vanishing_polynomial<NUM>(FF(point));
+        }
+        FF::batch_invert(vanishing_polynomial_evals);
 
         // Compute the combiner quotient polynomial as evaluations on points that are not in the vanishing set.
-        //
-        for (size_t point = ProverInstances::NUM; point < combiner.size(); point++) {
-            auto idx = point - ProverInstances::NUM;
-            auto lagrange_0 = FF(1) - FF(point);
-            auto vanishing_polynomial = FF(point) * (FF(point) - 1);
-
+        for (size_t point = NUM; point < combiner.size(); point++) {
+            auto idx = point - NUM;
+            auto lagrange_0 = compute_lagrange_polynomials<NUM>(FF(point))[0];
             combiner_quotient_evals[idx] =
-                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial.invert();
+                (combiner.value_at(point) - compressed_perturbator * lagrange_0) * vanishing_polynomial_evals[idx];
         }
 
-        Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, ProverInstances::NUM> combiner_quotient(
-            combiner_quotient_evals);
+        Univariate<FF, ProverInstances::BATCHED_EXTENDED_LENGTH, NUM> combiner_quotient(combiner_quotient_evals);
         return combiner_quotient;
     }
 
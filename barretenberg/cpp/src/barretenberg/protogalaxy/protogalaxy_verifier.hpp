@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/protogalaxy/folding_result.hpp"
+#include "barretenberg/protogalaxy/prover_verifier_shared.hpp"
 #include "barretenberg/stdlib_circuit_builders/goblin_ultra_flavor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/sumcheck/instance/instances.hpp"
@@ -0,0 +1,41 @@
+#pragma once
+#include <array>
+#include <cstddef>
+
+namespace bb {
+
+/**
+ * @brief Evaluate the vanishing polynomial Z(X) = X(X - 1)...(X - (k - 1)) of the folding domain {0, ..., k - 1} at
+ * a point, where k is the number of instances being folded.
+ */
+template <size_t NUM, typename FF> FF compute_vanishing_polynomial(const FF& point)
+{
+    FF result = point;
+    for (size_t j = 1; j < NUM; j++) {
+        result *= point - FF(j);
+    }
+    return result;
+}
+
+/**
+ * @brief Evaluate the Lagrange basis L_0(X), ..., L_{k-1}(X) of the folding domain {0, ..., k - 1} at a point, where
+ * L_i(X) = ∏_{j ≠ i} (X - j) / (i - j). For k = 2 this is {1 - X, X}.
+ */
+template <size_t NUM, typename FF> std::array<FF, NUM> compute_lagrange_polynomials(const FF& point)
+{
+    std::array<FF, NUM> lagranges;
+    for (size_t i = 0; i < NUM; i++) {
+        FF numerator(1);
+        FF denominator(1);
+        for (size_t j = 0; j < NUM; j++) {
+            if (j != i) {
+                numerator *= point - FF(j);
+                denominator *= FF(i) - FF(j);
+            }
+        }
+        lagranges[i] = numerator * denominator.invert();
+    }
+    return lagranges;
+}
+
+} // namespace bb
@@ -49,6 +49,9 @@ template <typename FF_> class AuxiliaryRelationImpl {
         1  // RAM consistency sub-relation 3
     };
 
+    // Every subrelation, including the RAM/ROM consistency checks, is scaled by q_aux
+    template <typename AllEntities> static const auto& get_gate_selector(const AllEntities& in) { return in.q_aux; }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The following explanation is reproduced from the Plonk analog 'plookup_auxiliary_widget':
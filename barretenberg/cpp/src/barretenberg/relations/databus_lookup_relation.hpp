@@ -50,6 +50,15 @@ template <typename FF_> class DatabusLookupRelationImpl {
      * @return auto&
      */
     template <typename AllEntities> static auto& get_inverse_polynomial(AllEntities& in) { return in.lookup_inverses; }
+
+    /**
+     * @brief Get the entities read when computing the inverse polynomial, see compute_logderivative_inverse
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.q_busread, in.calldata_read_counts, in.calldata, in.databus_id, in.w_l, in.w_r);
+    }
     /**
      * @brief Compute the Accumulator whose values indicate whether the inverse is computed or not
      * @details This is needed for efficiency since we don't need to compute the inverse unless the log derivative
@@ -14,6 +14,12 @@ template <typename FF_> class DeltaRangeConstraintRelationImpl {
         6  // range constrain sub-relation 4
     };
 
+    // The relation vanishes on rows that are not delta range gates, i.e. where q_delta_range is zero
+    template <typename AllEntities> static const auto& get_gate_selector(const AllEntities& in)
+    {
+        return in.q_delta_range;
+    }
+
     /**
      * @brief Expression for the generalized permutation sort gate.
      * @details The relation is defined as C(in(X)...) =
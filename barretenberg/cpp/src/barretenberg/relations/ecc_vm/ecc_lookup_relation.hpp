@@ -39,6 +39,35 @@ template <typename FF_> class ECCVMLookupRelationImpl {
      */
     template <typename AllEntities> static auto& get_inverse_polynomial(AllEntities& in) { return in.lookup_inverses; }
 
+    /**
+     * @brief Get the entities read when computing the inverse polynomial, see compute_logderivative_inverse
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_entities(AllEntities& in)
+    {
+        return std::forward_as_tuple(in.msm_add,
+                                     in.msm_skew,
+                                     in.precompute_select,
+                                     in.precompute_pc,
+                                     in.precompute_tx,
+                                     in.precompute_ty,
+                                     in.precompute_round,
+                                     in.msm_pc,
+                                     in.msm_count,
+                                     in.msm_slice1,
+                                     in.msm_slice2,
+                                     in.msm_slice3,
+                                     in.msm_slice4,
+                                     in.msm_x1,
+                                     in.msm_x2,
+                                     in.msm_x3,
+                                     in.msm_x4,
+                                     in.msm_y1,
+                                     in.msm_y2,
+                                     in.msm_y3,
+                                     in.msm_y4);
+    }
+
     template <typename Accumulator, typename AllEntities>
     static Accumulator compute_inverse_exists(const AllEntities& in)
     {
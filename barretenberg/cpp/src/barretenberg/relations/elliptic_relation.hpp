@@ -14,6 +14,12 @@ template <typename FF_> class EllipticRelationImpl {
         6, // y-coordinate sub-relation
     };
 
+    // The relation vanishes on rows that are not elliptic curve gates, i.e. where q_elliptic is zero
+    template <typename AllEntities> static const auto& get_gate_selector(const AllEntities& in)
+    {
+        return in.q_elliptic;
+    }
+
     // TODO(@zac-williamson #2609 find more generic way of doing this)
     static constexpr FF get_curve_b()
     {
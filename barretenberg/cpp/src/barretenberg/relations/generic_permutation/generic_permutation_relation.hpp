@@ -79,6 +79,19 @@ template <typename Settings, typename FF_> class GenericPermutationRelationImpl
         return std::get<INVERSE_POLYNOMIAL_INDEX>(Settings::get_nonconst_entities(in));
     }
 
+    /**
+     * @brief Get the entities read when computing the inverse polynomial, i.e. those returned by the Settings' getters
+     *
+     */
+    template <typename AllEntities> static auto get_inverse_entities(AllEntities& in)
+    {
+        if constexpr (std::is_const_v<AllEntities>) {
+            return Settings::get_const_entities(in);
+        } else {
+            return Settings::get_nonconst_entities(in);
+        }
+    }
+
     /**
      * @brief Get selector/wire switching on(1) or off(0) inverse computation
      * We turn it on if either of the permutation contribution selectors are active
@@ -13,6 +13,12 @@ template <typename FF_> class Poseidon2ExternalRelationImpl {
         7, // external poseidon2 round sub-relation for fourth value
     };
 
+    // The relation vanishes on rows that are not external Poseidon2 rounds
+    template <typename AllEntities> static const auto& get_gate_selector(const AllEntities& in)
+    {
+        return in.q_poseidon2_external;
+    }
+
     /**
      * @brief Expression for the poseidon2 external round relation, based on E_i in Section 6 of
      * https://eprint.iacr.org/2023/323.pdf.
@@ -15,6 +15,12 @@ template <typename FF_> class Poseidon2InternalRelationImpl {
         7, // internal poseidon2 round sub-relation for fourth value
     };
 
+    // The relation vanishes on rows that are not internal Poseidon2 rounds
+    template <typename AllEntities> static const auto& get_gate_selector(const AllEntities& in)
+    {
+        return in.q_poseidon2_internal;
+    }
+
     /**
      * @brief Expression for the poseidon2 internal round relation, based on I_i in Section 6 of
      * https://eprint.iacr.org/2023/323.pdf.
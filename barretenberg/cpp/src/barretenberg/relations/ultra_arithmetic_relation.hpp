@@ -12,6 +12,9 @@ template <typename FF_> class UltraArithmeticRelationImpl {
         5  // secondary arithmetic sub-relation
     };
 
+    // Both subrelations are scaled by q_arith, so the relation vanishes on rows where it is zero
+    template <typename AllEntities> static const auto& get_gate_selector(const AllEntities& in) { return in.q_arith; }
+
     /**
      * @brief Expression for the Ultra Arithmetic gate.
      * @details This relation encapsulates several idenitities, toggled by the value of q_arith in [0, 1, 2, 3, ...].
@@ -25,6 +25,15 @@ template <typename Curve> class ProverCrs {
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+    /**
+     * @brief Returns the fixed-base table of the monomial points consumed by
+     * scalar_multiplication::pippenger_fixed_base_unsafe, or nullptr if the crs was not created with one.
+     */
+    virtual const typename Curve::AffineElement* get_precomputed_monomial_points() const { return nullptr; }
+    /**
+     * @brief The window size the fixed-base table was generated with, or 0 if there is none.
+     */
+    virtual size_t get_precomputed_window_bits() const { return 0; }
 };
 
 template <typename Curve> class VerifierCrs {
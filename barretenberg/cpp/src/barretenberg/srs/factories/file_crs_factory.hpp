@@ -7,6 +7,7 @@
 #include "crs_factory.hpp"
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 namespace bb::srs::factories {
 
@@ -15,7 +16,13 @@ namespace bb::srs::factories {
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    /**
+     * @param path The directory holding the transcript files
+     * @param initial_degree
+     * @param precompute_window_bits If nonzero, the prover crs also holds a fixed-base table with this window size
+     * (see MemProverCrs)
+     */
+    FileCrsFactory(std::string path, size_t initial_degree = 0, size_t precompute_window_bits = 0);
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -25,28 +32,45 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
+    size_t precompute_window_bits_;
     std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<bb::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
+    FileProverCrs(const size_t num_points, std::string const& path, const size_t precompute_window_bits = 0)
         : num_points(num_points)
+        , precompute_window_bits_(precompute_window_bits)
     {
         monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
 
         srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        if (precompute_window_bits_ != 0) {
+            precomputed_.resize(num_points *
+                                scalar_multiplication::get_num_signed_digit_rounds(precompute_window_bits_));
+            scalar_multiplication::generate_fixed_base_table<Curve>(
+                monomials_.get(), precomputed_.data(), num_points, precompute_window_bits_);
+        }
     };
 
     typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
 
     [[nodiscard]] size_t get_monomial_size() const { return num_points; }
 
+    const typename Curve::AffineElement* get_precomputed_monomial_points() const override
+    {
+        return precomputed_.empty() ? nullptr : precomputed_.data();
+    }
+
+    size_t get_precomputed_window_bits() const override { return precompute_window_bits_; }
+
   private:
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    size_t precompute_window_bits_;
+    std::vector<typename Curve::AffineElement> precomputed_;
 };
 
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
@@ -41,8 +41,9 @@ class MemVerifierCrs : public VerifierCrs<curve::BN254> {
 namespace bb::srs::factories {
 
 MemBn254CrsFactory::MemBn254CrsFactory(std::vector<g1::affine_element> const& points,
-                                       g2::affine_element const& g2_point)
-    : prover_crs_(std::make_shared<MemProverCrs<curve::BN254>>(points))
+                                       g2::affine_element const& g2_point,
+                                       size_t precompute_window_bits)
+    : prover_crs_(std::make_shared<MemProverCrs<curve::BN254>>(points, precompute_window_bits))
     , verifier_crs_(std::make_shared<MemVerifierCrs>(g2_point))
 {}
 
@@ -15,7 +15,15 @@ namespace bb::srs::factories {
  */
 class MemBn254CrsFactory : public CrsFactory<curve::BN254> {
   public:
-    MemBn254CrsFactory(std::vector<g1::affine_element> const& points, g2::affine_element const& g2_point);
+    /**
+     * @param points The monomial points
+     * @param g2_point [x]₂
+     * @param precompute_window_bits If nonzero, the prover crs also holds a fixed-base table with this window size
+     * (see MemProverCrs)
+     */
+    MemBn254CrsFactory(std::vector<g1::affine_element> const& points,
+                       g2::affine_element const& g2_point,
+                       size_t precompute_window_bits = 0);
     MemBn254CrsFactory(MemBn254CrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<curve::BN254>> get_prover_crs(size_t degree) override;
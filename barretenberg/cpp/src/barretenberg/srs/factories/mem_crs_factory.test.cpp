@@ -45,6 +45,41 @@ TEST(reference_string, mem_bn254_file_consistency)
               0);
 }
 
+TEST(reference_string, precomputed_fixed_base_table)
+{
+    constexpr size_t num_points = 1024;
+    constexpr size_t window_bits = 10;
+    auto file_crs = FileCrsFactory<BN254>("../srs_db/ignition", num_points, window_bits);
+
+    std::vector<g1::affine_element> points(num_points);
+    ::srs::IO<BN254>::read_transcript_g1(points.data(), num_points, "../srs_db/ignition");
+    g2::affine_element g2_point;
+    ::srs::IO<BN254>::read_transcript_g2(g2_point, "../srs_db/ignition");
+    MemBn254CrsFactory mem_crs(points, g2_point, window_bits);
+
+    auto file_prover_crs = file_crs.get_prover_crs(num_points);
+    auto mem_prover_crs = mem_crs.get_prover_crs(num_points);
+    EXPECT_EQ(file_prover_crs->get_precomputed_window_bits(), window_bits);
+    EXPECT_EQ(mem_prover_crs->get_precomputed_window_bits(), window_bits);
+    ASSERT_NE(file_prover_crs->get_precomputed_monomial_points(), nullptr);
+    ASSERT_NE(mem_prover_crs->get_precomputed_monomial_points(), nullptr);
+
+    const size_t table_size = num_points * scalar_multiplication::get_num_signed_digit_rounds(window_bits);
+    EXPECT_EQ(memcmp(mem_prover_crs->get_precomputed_monomial_points(),
+                     file_prover_crs->get_precomputed_monomial_points(),
+                     sizeof(g1::affine_element) * table_size),
+              0);
+
+    // the rounds of a point are successive multiples by 2^window_bits
+    const g1::affine_element* table = file_prover_crs->get_precomputed_monomial_points();
+    EXPECT_EQ(table[0], points[0]);
+    EXPECT_EQ(table[1], g1::affine_element(g1::element(points[0]) * fr(uint64_t(1) << window_bits)));
+
+    // without a window size, no table is computed
+    auto plain_crs = FileCrsFactory<BN254>("../srs_db/ignition", num_points);
+    EXPECT_EQ(plain_crs.get_prover_crs(num_points)->get_precomputed_monomial_points(), nullptr);
+}
+
 TEST(reference_string, DISABLED_mem_grumpkin_file_consistency)
 {
     // Load 1024 from file.
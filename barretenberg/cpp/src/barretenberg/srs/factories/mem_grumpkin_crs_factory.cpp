@@ -37,8 +37,9 @@ class MemVerifierCrs : public VerifierCrs<Grumpkin> {
 
 namespace bb::srs::factories {
 
-MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::vector<Grumpkin::AffineElement> const& points)
-    : prover_crs_(std::make_shared<MemProverCrs<Grumpkin>>(points))
+MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::vector<Grumpkin::AffineElement> const& points,
+                                             size_t precompute_window_bits)
+    : prover_crs_(std::make_shared<MemProverCrs<Grumpkin>>(points, precompute_window_bits))
     , verifier_crs_(std::make_shared<MemVerifierCrs>(points))
 {}
 
@@ -12,7 +12,7 @@ namespace bb::srs::factories {
  */
 class MemGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
   public:
-    MemGrumpkinCrsFactory(std::vector<curve::Grumpkin::AffineElement> const& points);
+    MemGrumpkinCrsFactory(std::vector<curve::Grumpkin::AffineElement> const& points, size_t precompute_window_bits = 0);
     MemGrumpkinCrsFactory(MemGrumpkinCrsFactory&& other) = default;
 
     std::shared_ptr<bb::srs::factories::ProverCrs<curve::Grumpkin>> get_prover_crs(size_t degree) override;
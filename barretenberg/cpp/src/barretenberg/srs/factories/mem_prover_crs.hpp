@@ -4,25 +4,49 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/srs/factories/crs_factory.hpp"
 
+#include <vector>
+
 namespace bb::srs::factories {
 // Common to both Grumpkin and Bn254, and generally curves regardless of pairing-friendliness
 template <typename Curve> class MemProverCrs : public ProverCrs<Curve> {
   public:
-    MemProverCrs(std::vector<typename Curve::AffineElement> const& points)
+    /**
+     * @param points The monomial points
+     * @param precompute_window_bits If nonzero, also precompute a fixed-base table with this window size (see
+     * scalar_multiplication::generate_fixed_base_table). This makes every commitment cheaper in exchange for
+     * scalar_multiplication::get_num_signed_digit_rounds(precompute_window_bits) times the memory of the points.
+     */
+    MemProverCrs(std::vector<typename Curve::AffineElement> const& points, size_t precompute_window_bits = 0)
         : num_points(points.size())
         , monomials_(scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(points.size()))
+        , precompute_window_bits_(precompute_window_bits)
     {
         std::copy(points.begin(), points.end(), monomials_.get());
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+        if (precompute_window_bits_ != 0) {
+            precomputed_.resize(num_points *
+                                scalar_multiplication::get_num_signed_digit_rounds(precompute_window_bits_));
+            scalar_multiplication::generate_fixed_base_table<Curve>(
+                monomials_.get(), precomputed_.data(), num_points, precompute_window_bits_);
+        }
     }
 
     typename Curve::AffineElement* get_monomial_points() override { return monomials_.get(); }
 
     size_t get_monomial_size() const override { return num_points; }
 
+    const typename Curve::AffineElement* get_precomputed_monomial_points() const override
+    {
+        return precomputed_.empty() ? nullptr : precomputed_.data();
+    }
+
+    size_t get_precomputed_window_bits() const override { return precompute_window_bits_; }
+
   private:
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    size_t precompute_window_bits_;
+    std::vector<typename Curve::AffineElement> precomputed_;
 };
 
 } // namespace bb::srs::factories
\ No newline at end of file
@@ -19,12 +19,12 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
 }
 
 // Initializes crs from a file path this we use in the entire codebase
-void init_crs_factory(std::string crs_path)
+void init_crs_factory(std::string crs_path, size_t precompute_window_bits)
 {
     if (crs_factory != nullptr) {
         return;
     }
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, precompute_window_bits);
 }
 
 // Initializes the crs using the memory buffers
@@ -33,12 +33,13 @@ void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const
     grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(points);
 }
 
-void init_grumpkin_crs_factory(std::string crs_path)
+void init_grumpkin_crs_factory(std::string crs_path, size_t precompute_window_bits)
 {
     if (grumpkin_crs_factory != nullptr) {
         return;
     }
-    grumpkin_crs_factory = std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path);
+    grumpkin_crs_factory =
+        std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path, 0, precompute_window_bits);
 }
 
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory()
@@ -1,12 +1,14 @@
+#pragma once
 #include "./factories/crs_factory.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 
 namespace bb::srs {
 
-// Initializes the crs using files
-void init_crs_factory(std::string crs_path);
-void init_grumpkin_crs_factory(std::string crs_path);
+// Initializes the crs using files. If precompute_window_bits is nonzero, the prover crs also precomputes a fixed-base
+// table with that window size, making commitments faster at the cost of memory (see MemProverCrs).
+void init_crs_factory(std::string crs_path, size_t precompute_window_bits = 0);
+void init_grumpkin_crs_factory(std::string crs_path, size_t precompute_window_bits = 0);
 
 // Initializes the crs using memory buffers
 void init_grumpkin_crs_factory(std::vector<curve::Grumpkin::AffineElement> const& points);
@@ -18,6 +18,7 @@
 #include "barretenberg/srs/io.hpp"
 
 #include <cstddef>
+#include <functional>
 #include <vector>
 
 using namespace bb;
@@ -959,6 +960,128 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatchUnsafe)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+    // include empty, tiny, non-power-of-two and sparse inputs
+    const std::vector<size_t> sizes = { num_points, 0, 1, 7, 300, 5000, num_points };
+
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    std::vector<std::vector<Fr>> scalars(sizes.size());
+    std::vector<Element> expected(sizes.size());
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        scalars[i].resize(sizes[i]);
+        expected[i].self_set_infinity();
+        for (size_t j = 0; j < sizes[i]; ++j) {
+            // the last scalar set is mostly zeros and ones
+            if (i == sizes.size() - 1) {
+                scalars[i][j] = (j % 5 == 0) ? Fr::random_element() : Fr(j % 5 == 1);
+            } else {
+                scalars[i][j] = Fr::random_element();
+            }
+            expected[i] += points[j] * scalars[i][j];
+        }
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    std::vector<std::span<const Fr>> scalar_spans(scalars.begin(), scalars.end());
+    std::vector<Element> results = scalar_multiplication::pippenger_batch_unsafe<Curve>(scalar_spans, points);
+
+    ASSERT_EQ(results.size(), sizes.size());
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        EXPECT_EQ(AffineElement(results[i]), AffineElement(expected[i]));
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSparseUnsafe)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 5001;
+
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    std::vector<AffineElement> base_points(points, points + num_points);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    // all zero, all one, selector-like, mostly zero with a few random values, and dense (which falls back to the
+    // regular pippenger)
+    const std::vector<std::function<Fr(size_t)>> distributions = {
+        [](size_t) { return Fr::zero(); },
+        [](size_t) { return Fr::one(); },
+        [](size_t j) { return Fr(j % 3 == 0); },
+        [](size_t j) { return (j % 17 == 0) ? Fr::random_element() : Fr(j % 17 == 1); },
+        [](size_t) { return Fr::random_element(); },
+    };
+    for (const auto& distribution : distributions) {
+        std::vector<Fr> scalars(num_points);
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t j = 0; j < num_points; ++j) {
+            scalars[j] = distribution(j);
+            expected += base_points[j] * scalars[j];
+        }
+        Element result = scalar_multiplication::pippenger_sparse_unsafe<Curve>(scalars, points, state);
+        EXPECT_EQ(AffineElement(result), AffineElement(expected));
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerFixedBaseUnsafe)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 3000;
+
+    auto point_table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    AffineElement* points = point_table.get();
+    for (size_t i = 0; i < num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+
+    // a dense vector, a sparse one, and a short one that only uses the start of the table
+    std::vector<std::vector<Fr>> scalar_sets(3);
+    std::vector<Element> expected(3);
+    for (size_t i = 0; i < 3; ++i) {
+        const size_t size = (i == 2) ? 33 : num_points;
+        expected[i].self_set_infinity();
+        for (size_t j = 0; j < size; ++j) {
+            scalar_sets[i].emplace_back((i == 1 && j % 7 != 0) ? Fr(j % 2) : Fr::random_element());
+            expected[i] += points[j] * scalar_sets[i][j];
+        }
+    }
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points, points, num_points);
+
+    for (const size_t window_bits : std::vector<size_t>{ 2, 5, 8, 13 }) {
+        std::vector<AffineElement> table(num_points * scalar_multiplication::get_num_signed_digit_rounds(window_bits));
+        scalar_multiplication::generate_fixed_base_table<Curve>(points, table.data(), num_points, window_bits);
+        for (size_t i = 0; i < 3; ++i) {
+            Element result =
+                scalar_multiplication::pippenger_fixed_base_unsafe<Curve>(scalar_sets[i], table.data(), window_bits);
+            EXPECT_EQ(AffineElement(result), AffineElement(expected[i]));
+        }
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
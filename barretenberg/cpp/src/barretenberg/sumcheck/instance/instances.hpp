@@ -71,6 +71,22 @@ template <typename Flavor_, size_t NUM_ = 2> struct ProverInstances_ {
         return results;
     }
 
+    /**
+     * @brief Get the end of the rows holding gates in any of the instances, past which every gate selector vanishes in
+     * all of them. Returns 0 if it is unknown for one of the instances (see ProvingKey_::active_trace_end).
+     */
+    size_t get_active_trace_end() const
+    {
+        size_t active_trace_end = 0;
+        for (const auto& instance : _data) {
+            if (instance->proving_key.active_trace_end == 0) {
+                return 0;
+            }
+            active_trace_end = std::max(active_trace_end, instance->proving_key.active_trace_end);
+        }
+        return active_trace_end;
+    }
+
   private:
     // Returns a vector containing pointer views to the prover polynomials corresponding to each instance.
     auto get_polynomials_views() const
@@ -318,3 +318,59 @@ TYPED_TEST(PartialEvaluationTests, ThreeRoundsGenericMultiplePolys)
         EXPECT_EQ((polynomial_get_all[i])[0], expected_val[i]);
     }
 }
+
+/*
+ * A structured polynomial only stores its active range. Partially evaluating it must agree with partially evaluating
+ * the dense polynomial with the same coefficients, in every round.
+ */
+TYPED_TEST(PartialEvaluationTests, ThreeRoundsStructured)
+{
+    using Flavor = TypeParam;
+    using FF = typename Flavor::FF;
+    using Transcript = typename Flavor::Transcript;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+    const size_t multivariate_d(4);
+    const size_t multivariate_n(1 << multivariate_d);
+
+    // stores [5, 11) of 16 coefficients
+    Polynomial<FF> structured(6, multivariate_n, 5);
+    Polynomial<FF> dense(multivariate_n);
+    for (size_t i = structured.start_index(); i < structured.end_index(); ++i) {
+        structured[i] = FF::random_element();
+        dense[i] = structured[i];
+    }
+
+    ProverPolynomials structured_polynomials;
+    ProverPolynomials dense_polynomials;
+    for (auto [structured_poly, dense_poly] :
+         zip_view(structured_polynomials.get_all(), dense_polynomials.get_all())) {
+        structured_poly = Polynomial<FF>(multivariate_n);
+        dense_poly = Polynomial<FF>(multivariate_n);
+    }
+    structured_polynomials.get_all()[0] = structured.share();
+    dense_polynomials.get_all()[0] = dense.share();
+
+    auto transcript = Transcript::prover_init_empty();
+    auto structured_sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+    auto dense_sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript);
+
+    size_t round_size = multivariate_n;
+    for (size_t round = 0; round < multivariate_d; ++round) {
+        FF round_challenge = FF::random_element();
+        if (round == 0) {
+            structured_sumcheck.partially_evaluate(structured_polynomials, round_size, round_challenge);
+            dense_sumcheck.partially_evaluate(dense_polynomials, round_size, round_challenge);
+        } else {
+            structured_sumcheck.partially_evaluate(
+                structured_sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+            dense_sumcheck.partially_evaluate(dense_sumcheck.partially_evaluated_polynomials, round_size, round_challenge);
+        }
+        round_size >>= 1;
+        auto& structured_result = structured_sumcheck.partially_evaluated_polynomials.get_all()[0];
+        auto& dense_result = dense_sumcheck.partially_evaluated_polynomials.get_all()[0];
+        for (size_t i = 0; i < round_size; ++i) {
+            EXPECT_EQ(structured_result[i], dense_result[i]);
+        }
+    }
+}
@@ -56,6 +56,8 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+    // The range [start, end) of each partially evaluated polynomial outside of which it is zero
+    std::vector<std::pair<size_t, size_t>> partially_evaluated_ranges;
 
     // prover instantiates sumcheck with circuit size and a prover transcript
     SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
@@ -147,10 +149,33 @@ template <typename Flavor> class SumcheckProver {
         auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
         // after the first round, operate in place on partially_evaluated_polynomials
+        const bool in_place = static_cast<const void*>(&polynomials) == &partially_evaluated_polynomials;
+        partially_evaluated_ranges.resize(pep_view.size());
+        const size_t half_size = round_size >> 1;
         parallel_for(poly_view.size(), [&](size_t j) {
-            for (size_t i = 0; i < round_size; i += 2) {
-                pep_view[j][i >> 1] = poly_view[j][i] + round_challenge * (poly_view[j][i + 1] - poly_view[j][i]);
+            // Only the active range of each polynomial is folded, everything outside it is zero (see
+            // Polynomial::start_index()). Edges are pairs (2i, 2i + 1), so the range starts on an even index.
+            auto [start, end] = in_place ? partially_evaluated_ranges[j]
+                                         : std::pair{ poly_view[j].start_index(), poly_view[j].end_index() };
+            end = std::min(end, round_size);
+            start = std::min(start & ~static_cast<size_t>(1), end);
+            for (size_t i = start; i < end; i += 2) {
+                const FF lo = poly_view[j].get(i);
+                pep_view[j][i >> 1] = lo + round_challenge * (poly_view[j].get(i + 1) - lo);
+            }
+            const size_t folded_start = start >> 1;
+            const size_t folded_end = (end + 1) >> 1;
+            // Clear whatever was left outside the new range. In place, only the tail of the old range can be nonzero.
+            if (!in_place) {
+                for (size_t i = 0; i < folded_start; ++i) {
+                    pep_view[j][i] = 0;
+                }
+            }
+            const size_t stale_end = in_place ? std::min(end, half_size) : half_size;
+            for (size_t i = folded_end; i < stale_end; ++i) {
+                pep_view[j][i] = 0;
             }
+            partially_evaluated_ranges[j] = { folded_start, folded_end };
         });
     };
     /**
@@ -161,6 +186,7 @@ template <typename Flavor> class SumcheckProver {
     void partially_evaluate(std::array<PolynomialT, N>& polynomials, size_t round_size, FF round_challenge)
     {
         auto pep_view = partially_evaluated_polynomials.get_all();
+        partially_evaluated_ranges.assign(pep_view.size(), { 0, round_size >> 1 });
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(polynomials.size(), [&](size_t j) {
             for (size_t i = 0; i < round_size; i += 2) {
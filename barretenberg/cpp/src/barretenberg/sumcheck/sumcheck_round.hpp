@@ -62,6 +62,11 @@ template <typename Flavor> class SumcheckProverRound {
 
     size_t round_size; // a power of 2
 
+    // Number of consecutive edge groups that are extended together, see extend_edge_block. 1 extends one edge group at
+    // a time.
+    size_t edge_block_size = DEFAULT_EDGE_BLOCK_SIZE;
+
+    static constexpr size_t DEFAULT_EDGE_BLOCK_SIZE = 8;
     static constexpr size_t NUM_RELATIONS = Flavor::NUM_RELATIONS;
     static constexpr size_t MAX_PARTIAL_RELATION_LENGTH = Flavor::MAX_PARTIAL_RELATION_LENGTH;
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
@@ -89,11 +94,37 @@ template <typename Flavor> class SumcheckProverRound {
                       size_t edge_idx)
     {
         for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-            bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
+            bb::Univariate<FF, 2> edge({ multivariate.get(edge_idx), multivariate.get(edge_idx + 1) });
             extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
         }
     }
 
+    /**
+     * @brief Extend the edges of the edge groups at edge_idx, edge_idx + 2, ... into the extended edges viewed by
+     * `extended_edge_views`, one edge group per view.
+     *
+     * @details The result is the same as calling extend_edges once per edge group, but the work is done column by
+     * column: each multivariate is read as a single contiguous run of values and all its edges are extended in one
+     * tight loop, rather than touching every multivariate once per edge group. The relations are then accumulated
+     * from the block one edge group at a time.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates, typename ExtendedEdgesView>
+    void extend_edge_block(std::span<ExtendedEdgesView> extended_edge_views,
+                           const ProverPolynomialsOrPartiallyEvaluatedMultivariates& multivariates,
+                           size_t edge_idx)
+    {
+        auto columns = multivariates.get_all();
+        for (size_t column_idx = 0; column_idx < columns.size(); ++column_idx) {
+            const auto& multivariate = columns[column_idx];
+            size_t idx = edge_idx;
+            for (auto& extended_edges : extended_edge_views) {
+                bb::Univariate<FF, 2> edge({ multivariate.get(idx), multivariate.get(idx + 1) });
+                extended_edges[column_idx] = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+                idx += 2;
+            }
+        }
+    }
+
     /**
      * @brief Return the evaluations of the univariate restriction (S_l(X_l) in the thesis) at num_multivariates-many
      * values. Most likely this will end up being S_l(0), ... , S_l(t-1) where t is around 12. At the end, reset all
@@ -131,24 +162,32 @@ template <typename Flavor> class SumcheckProverRound {
             Utils::zero_univariates(accum);
         }
 
-        // Construct extended edge containers; one per thread
-        std::vector<ExtendedEdges> extended_edges;
-        extended_edges.resize(num_threads);
-
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
+        const size_t block_size = std::max(edge_block_size, static_cast<size_t>(1));
         parallel_for(num_threads, [&](size_t thread_idx) {
             size_t start = thread_idx * iterations_per_thread;
             size_t end = (thread_idx + 1) * iterations_per_thread;
 
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+            // Extended edges of a block of edge groups, with their views built once rather than per edge group
+            std::vector<ExtendedEdges> extended_edges(block_size);
+            std::vector<decltype(extended_edges[0].get_all())> extended_edge_views;
+            extended_edge_views.reserve(block_size);
+            for (auto& edges : extended_edges) {
+                extended_edge_views.emplace_back(edges.get_all());
+            }
+
+            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2 * block_size) {
+                const size_t num_edges = std::min(block_size, (end - edge_idx) >> 1);
+                extend_edge_block(std::span(extended_edge_views).first(num_edges), polynomials, edge_idx);
 
                 // Compute the i-th edge's univariate contribution,
                 // scale it by pow_challenge constant contribution and add it to the accumulators for Sˡ(Xₗ)
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                pow_challenges[edge_idx >> 1]);
+                for (size_t i = 0; i < num_edges; ++i) {
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[i],
+                                                    relation_parameters,
+                                                    pow_challenges[(edge_idx >> 1) + i]);
+                }
             }
         });
 
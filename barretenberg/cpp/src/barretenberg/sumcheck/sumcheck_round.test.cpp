@@ -131,3 +131,47 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that extending edges in blocks gives the same round univariate as extending one edge group at a time,
+ * including when the block size does not divide the number of edge groups
+ *
+ */
+TEST(SumcheckRound, EdgeBlocksMatchSingleEdges)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using ProverPolynomials = typename Flavor::ProverPolynomials;
+
+    const size_t multivariate_d = 7;
+    const size_t multivariate_n = 1 << multivariate_d;
+
+    ProverPolynomials polynomials;
+    for (auto& poly : polynomials.get_all()) {
+        poly = Polynomial<FF>(multivariate_n);
+        for (auto& coeff : poly) {
+            coeff = FF::random_element();
+        }
+    }
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    typename Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> betas(multivariate_d);
+    for (auto& beta : betas) {
+        beta = FF::random_element();
+    }
+    PowPolynomial<FF> pow_polynomial(betas);
+    pow_polynomial.compute_values();
+
+    SumcheckProverRound<Flavor> single_round(multivariate_n);
+    single_round.edge_block_size = 1;
+    auto expected = single_round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha);
+
+    for (const size_t block_size : { size_t{ 3 }, size_t{ 8 }, size_t{ 256 } }) {
+        SumcheckProverRound<Flavor> block_round(multivariate_n);
+        block_round.edge_block_size = block_size;
+        EXPECT_EQ(block_round.compute_univariate(polynomials, relation_parameters, pow_polynomial, alpha), expected);
+    }
+}
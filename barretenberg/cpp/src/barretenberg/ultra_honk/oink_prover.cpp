@@ -65,9 +65,11 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 {
     // Commit to the first three wire polynomials of the instance
     // We only commit to the fourth wire polynomial after adding memory recordss
-    witness_commitments.w_l = commitment_key->commit(proving_key.w_l);
-    witness_commitments.w_r = commitment_key->commit(proving_key.w_r);
-    witness_commitments.w_o = commitment_key->commit(proving_key.w_o);
+    std::array<std::span<const FF>, 3> wire_polynomials{ proving_key.w_l, proving_key.w_r, proving_key.w_o };
+    auto wire_commitments = commitment_key->batch_commit(wire_polynomials);
+    witness_commitments.w_l = wire_commitments[0];
+    witness_commitments.w_r = wire_commitments[1];
+    witness_commitments.w_o = wire_commitments[2];
 
     auto wire_comms = witness_commitments.get_wires();
     auto wire_labels = commitment_labels.get_wires();
@@ -76,20 +78,24 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     }
 
     if constexpr (IsGoblinFlavor<Flavor>) {
-        // Commit to Goblin ECC op wires
-        witness_commitments.ecc_op_wire_1 = commitment_key->commit(proving_key.ecc_op_wire_1);
-        witness_commitments.ecc_op_wire_2 = commitment_key->commit(proving_key.ecc_op_wire_2);
-        witness_commitments.ecc_op_wire_3 = commitment_key->commit(proving_key.ecc_op_wire_3);
-        witness_commitments.ecc_op_wire_4 = commitment_key->commit(proving_key.ecc_op_wire_4);
+        // Commit to Goblin ECC op wires and DataBus columns
+        std::array<std::span<const FF>, 6> goblin_polynomials{ proving_key.ecc_op_wire_1, proving_key.ecc_op_wire_2,
+                                                               proving_key.ecc_op_wire_3, proving_key.ecc_op_wire_4,
+                                                               proving_key.calldata,
+                                                               proving_key.calldata_read_counts };
+        auto goblin_commitments = commitment_key->batch_commit(goblin_polynomials);
+        witness_commitments.ecc_op_wire_1 = goblin_commitments[0];
+        witness_commitments.ecc_op_wire_2 = goblin_commitments[1];
+        witness_commitments.ecc_op_wire_3 = goblin_commitments[2];
+        witness_commitments.ecc_op_wire_4 = goblin_commitments[3];
+        witness_commitments.calldata = goblin_commitments[4];
+        witness_commitments.calldata_read_counts = goblin_commitments[5];
 
         auto op_wire_comms = witness_commitments.get_ecc_op_wires();
         auto labels = commitment_labels.get_ecc_op_wires();
         for (size_t idx = 0; idx < Flavor::NUM_WIRES; ++idx) {
             transcript->send_to_verifier(domain_separator + labels[idx], op_wire_comms[idx]);
         }
-        // Commit to DataBus columns
-        witness_commitments.calldata = commitment_key->commit(proving_key.calldata);
-        witness_commitments.calldata_read_counts = commitment_key->commit(proving_key.calldata_read_counts);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata, witness_commitments.calldata);
         transcript->send_to_verifier(domain_separator + commitment_labels.calldata_read_counts,
                                      witness_commitments.calldata_read_counts);
@@ -113,8 +119,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
         relation_parameters.eta, relation_parameters.eta_two, relation_parameters.eta_three);
     // Commit to the sorted witness-table accumulator and the finalized (i.e. with memory records) fourth wire
     // polynomial
-    witness_commitments.sorted_accum = commitment_key->commit(proving_key.sorted_accum);
-    witness_commitments.w_4 = commitment_key->commit(proving_key.w_4);
+    std::array<std::span<const FF>, 2> polynomials{ proving_key.sorted_accum, proving_key.w_4 };
+    auto commitments = commitment_key->batch_commit(polynomials);
+    witness_commitments.sorted_accum = commitments[0];
+    witness_commitments.w_4 = commitments[1];
 
     transcript->send_to_verifier(domain_separator + commitment_labels.sorted_accum, witness_commitments.sorted_accum);
     transcript->send_to_verifier(domain_separator + commitment_labels.w_4, witness_commitments.w_4);
@@ -147,8 +155,10 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_grand_product_c
 
     proving_key.compute_grand_product_polynomials(relation_parameters);
 
-    witness_commitments.z_perm = commitment_key->commit(proving_key.z_perm);
-    witness_commitments.z_lookup = commitment_key->commit(proving_key.z_lookup);
+    std::array<std::span<const FF>, 2> grand_products{ proving_key.z_perm, proving_key.z_lookup };
+    auto commitments = commitment_key->batch_commit(grand_products);
+    witness_commitments.z_perm = commitments[0];
+    witness_commitments.z_lookup = commitments[1];
 
     transcript->send_to_verifier(domain_separator + commitment_labels.z_perm, witness_commitments.z_perm);
     transcript->send_to_verifier(domain_separator + commitment_labels.z_lookup, witness_commitments.z_lookup);
@@ -112,6 +112,50 @@ TEST_F(UltraHonkComposerTests, PublicInputs)
     prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief Batch verify proofs of circuits of different sizes, then check that one bad proof fails the whole batch
+ *
+ */
+TEST_F(UltraHonkComposerTests, BatchVerify)
+{
+    const auto construct_circuit = [](size_t num_gates, bool satisfied) {
+        auto builder = UltraCircuitBuilder();
+        for (size_t i = 0; i < num_gates; ++i) {
+            fr a = fr::random_element();
+            uint32_t a_idx = builder.add_public_variable(a);
+
+            fr b = fr::random_element();
+            fr c = fr::random_element();
+            fr d = a + b + c + (satisfied ? fr(0) : fr(1));
+            uint32_t b_idx = builder.add_variable(b);
+            uint32_t c_idx = builder.add_variable(c);
+            uint32_t d_idx = builder.add_variable(d);
+
+            builder.create_big_add_gate({ a_idx, b_idx, c_idx, d_idx, fr(1), fr(1), fr(1), fr(-1), fr(0) });
+        }
+        return builder;
+    };
+
+    std::vector<std::shared_ptr<VerificationKey>> keys;
+    std::vector<HonkProof> proofs;
+    const auto add_proof = [&](UltraCircuitBuilder& builder) {
+        auto instance = std::make_shared<ProverInstance>(builder);
+        UltraProver prover(instance);
+        keys.emplace_back(std::make_shared<VerificationKey>(instance->proving_key));
+        proofs.emplace_back(prover.construct_proof());
+    };
+
+    for (size_t num_gates : { 10UL, 100UL, 1000UL }) {
+        auto builder = construct_circuit(num_gates, /*satisfied=*/true);
+        add_proof(builder);
+    }
+    EXPECT_TRUE(UltraVerifier::batch_verify_proofs(keys, proofs));
+
+    auto builder = construct_circuit(100, /*satisfied=*/false);
+    add_proof(builder);
+    EXPECT_FALSE(UltraVerifier::batch_verify_proofs(keys, proofs));
+}
+
 TEST_F(UltraHonkComposerTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
@@ -1,5 +1,6 @@
 #include "./ultra_verifier.hpp"
 #include "barretenberg/commitment_schemes/zeromorph/zeromorph.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/oink_verifier.hpp"
@@ -40,6 +41,24 @@ template <typename Flavor> UltraVerifier_<Flavor>& UltraVerifier_<Flavor>::opera
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof)
+{
+    auto pairing_points = reduce_to_pairing_check(proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    return key->pcs_verification_key->pairing_check((*pairing_points)[0], (*pairing_points)[1]);
+}
+
+/**
+ * @brief Run every check of an Ultra Honk proof except the final pairing, returning the pairing inputs
+ * @details The proof is valid iff the result is non-empty and e(P₀,[1]₂)e(P₁,[x]₂) ≡ [1]ₜ for the returned {P₀, P₁}.
+ * Deferring the pairing lets several proofs share one (see batch_verify_proofs).
+ *
+ * @return std::nullopt if Sumcheck failed, otherwise the inputs to the final pairing check
+ */
+template <typename Flavor>
+std::optional<typename UltraVerifier_<Flavor>::PairingPoints> UltraVerifier_<Flavor>::reduce_to_pairing_check(
+    const HonkProof& proof)
 {
     using FF = typename Flavor::FF;
     using PCS = typename Flavor::PCS;
@@ -67,22 +86,56 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
     auto [multivariate_challenge, claimed_evaluations, sumcheck_verified] =
         sumcheck.verify(relation_parameters, alphas, gate_challenges);
 
-    // If Sumcheck did not verify, return false
-    if (sumcheck_verified.has_value() && !sumcheck_verified.value()) {
-        return false;
+    // If Sumcheck did not verify, there is nothing left to check
+    if (!sumcheck_verified.has_value() || !sumcheck_verified.value()) {
+        return std::nullopt;
     }
 
     // Execute ZeroMorph rounds and check the pcs verifier accumulator returned. See
     // https://hackmd.io/dlf9xEwhTQyE3hiGbq4FsA?view for a complete description of the unrolled protocol.
-    auto pairing_points = ZeroMorph::verify(commitments.get_unshifted(),
-                                            commitments.get_to_be_shifted(),
-                                            claimed_evaluations.get_unshifted(),
-                                            claimed_evaluations.get_shifted(),
-                                            multivariate_challenge,
-                                            transcript);
-    auto pcs_verified = key->pcs_verification_key->pairing_check(pairing_points[0], pairing_points[1]);
-    return sumcheck_verified.value() && pcs_verified;
-    ;
+    return ZeroMorph::verify(commitments.get_unshifted(),
+                             commitments.get_to_be_shifted(),
+                             claimed_evaluations.get_unshifted(),
+                             claimed_evaluations.get_shifted(),
+                             multivariate_challenge,
+                             transcript);
+}
+
+/**
+ * @brief Verify a batch of Ultra Honk proofs, sharing a single pairing check between all of them
+ * @details Each proof is reduced to its pairing inputs independently (and in parallel), then the inputs are randomly
+ * combined into one pairing by VerifierCommitmentKey::batch_pairing_check. The keys only need to share an SRS, so the
+ * proofs may be for different circuits.
+ *
+ * @param keys the verification key of each proof, or a single key shared by all of them
+ * @param proofs
+ * @return true iff every proof is valid
+ */
+template <typename Flavor>
+bool UltraVerifier_<Flavor>::batch_verify_proofs(const std::vector<std::shared_ptr<VerificationKey>>& keys,
+                                                 const std::vector<HonkProof>& proofs)
+{
+    ASSERT(keys.size() == proofs.size() || keys.size() == 1);
+    if (proofs.empty()) {
+        return true;
+    }
+
+    std::vector<PairingPoints> pairing_points(proofs.size());
+    // A flag per proof rather than a shared one, since the loop body runs concurrently
+    std::vector<uint8_t> reduced(proofs.size(), 0);
+    parallel_for(proofs.size(), [&](size_t i) {
+        UltraVerifier_ verifier{ keys[keys.size() == 1 ? 0 : i] };
+        auto result = verifier.reduce_to_pairing_check(proofs[i]);
+        if (result.has_value()) {
+            pairing_points[i] = *result;
+            reduced[i] = 1;
+        }
+    });
+    if (std::find(reduced.begin(), reduced.end(), 0) != reduced.end()) {
+        return false;
+    }
+
+    return keys[0]->pcs_verification_key->batch_pairing_check(pairing_points);
 }
 
 template class UltraVerifier_<UltraFlavor>;
@@ -5,6 +5,8 @@
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include "barretenberg/sumcheck/sumcheck.hpp"
 
+#include <optional>
+
 namespace bb {
 template <typename Flavor> class UltraVerifier_ {
     using FF = typename Flavor::FF;
@@ -14,6 +16,8 @@ template <typename Flavor> class UltraVerifier_ {
     using Transcript = typename Flavor::Transcript;
 
   public:
+    using PairingPoints = std::array<typename Flavor::GroupElement, 2>;
+
     explicit UltraVerifier_(const std::shared_ptr<Transcript>& transcript,
                             const std::shared_ptr<VerificationKey>& verifier_key = nullptr);
 
@@ -24,6 +28,10 @@ template <typename Flavor> class UltraVerifier_ {
     UltraVerifier_& operator=(UltraVerifier_&& other);
 
     bool verify_proof(const HonkProof& proof);
+    std::optional<PairingPoints> reduce_to_pairing_check(const HonkProof& proof);
+
+    static bool batch_verify_proofs(const std::vector<std::shared_ptr<VerificationKey>>& keys,
+                                    const std::vector<HonkProof>& proofs);
 
     std::shared_ptr<VerificationKey> key;
     std::shared_ptr<Transcript> transcript;